@@ -318,6 +318,29 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive all messages that are available at once.
+ *
+ * Takes up to @p max messages from the calling thread's message queue and
+ * from threads blocked sending to it in a single critical section, in the
+ * order they would have been received by repeated calls to @ref msg_receive().
+ * Compared to calling @ref msg_receive() repeatedly, this disables interrupts
+ * and goes through the scheduler only once for a whole burst of messages.
+ *
+ * If @p block is true and no message is available, this blocks until one
+ * message arrives. Messages that got queued while the thread was waking up
+ * are then received as well.
+ *
+ * @param[out] buf      Array of at least @p max ``msg_t`` structures, must not
+ *                      be NULL.
+ * @param[in]  max      Maximum number of messages to receive.
+ * @param[in]  block    Wait for a message if none is available.
+ *
+ * @return  Number of messages received. Only 0 if @p block is false and no
+ *          message was available, or if @p max is 0.
+ */
+int msg_receive_many(msg_t *buf, unsigned max, bool block);
+
 /**
  * @brief Send a message, block until reply received.
  *
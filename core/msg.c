@@ -33,6 +33,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace_event.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -41,6 +42,13 @@ static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                      unsigned state);
 
+static inline void _trace_msg(uint16_t id, kernel_pid_t peer, const msg_t *m)
+{
+    if (IS_USED(MODULE_TRACE_EVENT_MSG)) {
+        trace_event(id, ((uint32_t)(uint16_t)peer << 16) | m->type);
+    }
+}
+
 static int queue_msg(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
@@ -119,6 +127,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
                   " has a msg_queue. Queueing message.\n", __FILE__,
                   __LINE__, target_pid);
             irq_restore(state);
+            _trace_msg(TRACE_EVENT_ID_MSG_SEND, target_pid, m);
             if (me->status == STATUS_REPLY_BLOCKED
                 || (IS_USED(MODULE_CORE_THREAD_FLAGS) &&
                     sched_context_switch_request)
@@ -158,6 +167,9 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         thread_flags_wake(target);
 #endif
 
+        /* record now, m holds the reply once we are back when called by
+         * msg_send_receive() */
+        _trace_msg(TRACE_EVENT_ID_MSG_SEND, target_pid, m);
         irq_restore(state);
         thread_yield_higher();
 
@@ -174,6 +186,7 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         sched_set_status(target, STATUS_PENDING);
 
         irq_restore(state);
+        _trace_msg(TRACE_EVENT_ID_MSG_SEND, target_pid, m);
         thread_yield_higher();
     }
 
@@ -188,6 +201,9 @@ int msg_send_to_self(msg_t *m)
     int res = queue_msg(thread_get_active(), m);
 
     irq_restore(state);
+    if (res > 0) {
+        _trace_msg(TRACE_EVENT_ID_MSG_SEND, m->sender_pid, m);
+    }
     return res;
 }
 
@@ -235,6 +251,9 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     m->sender_pid = KERNEL_PID_ISR;
 
     res = _msg_send_oneway(m, target_pid);
+    if (res > 0) {
+        _trace_msg(TRACE_EVENT_ID_MSG_SEND, target_pid, m);
+    }
 
     return res;
 }
@@ -313,6 +332,7 @@ int msg_reply(msg_t *m, msg_t *reply)
     uint16_t target_prio = target->priority;
 
     irq_restore(state);
+    _trace_msg(TRACE_EVENT_ID_MSG_SEND, target->pid, reply);
     sched_switch(target_prio);
 
     return 1;
@@ -337,17 +357,26 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
     sched_context_switch_request = 1;
+    _trace_msg(TRACE_EVENT_ID_MSG_SEND, target->pid, reply);
     return 1;
 }
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        _trace_msg(TRACE_EVENT_ID_MSG_RECV, m->sender_pid, m);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    _trace_msg(TRACE_EVENT_ID_MSG_RECV, m->sender_pid, m);
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -439,6 +468,103 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+/* copy the message of a thread blocked sending to us and unblock it,
+ * returns the priority of the unblocked thread, or THREAD_PRIORITY_IDLE if it
+ * stays blocked waiting for a reply */
+static uint16_t _msg_take_from_waiter(list_node_t *waiter, msg_t *m)
+{
+    thread_t *sender = container_of((clist_node_t *)waiter, thread_t, rq_entry);
+
+    *m = *(msg_t *)sender->wait_data;
+
+    if (sender->status != STATUS_REPLY_BLOCKED) {
+        sender->wait_data = NULL;
+        sched_set_status(sender, STATUS_PENDING);
+        return sender->priority;
+    }
+
+    return THREAD_PRIORITY_IDLE;
+}
+
+int msg_receive_many(msg_t *buf, unsigned max, bool block)
+{
+    if (max == 0) {
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    list_node_t *next;
+    unsigned n = 0;
+
+    DEBUG("msg_receive_many: %" PRIkernel_pid ": up to %u messages.\n",
+          thread_getpid(), max);
+
+    /* queued messages are older than those of waiting senders */
+    if (thread_has_msg_queue(me)) {
+        int queue_index;
+        while ((n < max) && ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+            buf[n++] = me->msg_array[queue_index];
+        }
+    }
+
+    while ((n < max) && (next = list_remove_head(&me->msg_waiters))) {
+        uint16_t prio = _msg_take_from_waiter(next, &buf[n++]);
+        if (prio < sender_prio) {
+            sender_prio = prio;
+        }
+    }
+
+    /* move remaining senders into the just freed queue space */
+    if (thread_has_msg_queue(me)) {
+        while (me->msg_waiters.next) {
+            int queue_index = cib_put(&(me->msg_queue));
+            if (queue_index < 0) {
+                break;
+            }
+            next = list_remove_head(&me->msg_waiters);
+            uint16_t prio = _msg_take_from_waiter(next,
+                                                  &me->msg_array[queue_index]);
+            if (prio < sender_prio) {
+                sender_prio = prio;
+            }
+        }
+    }
+
+    if (n == 0) {
+        if (!block) {
+            irq_restore(state);
+            return 0;
+        }
+
+        DEBUG("msg_receive_many(): %" PRIkernel_pid ": No msg available. "
+              "Going blocked.\n", thread_getpid());
+        me->wait_data = (void *)buf;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+
+        _trace_msg(TRACE_EVENT_ID_MSG_RECV, buf[0].sender_pid, &buf[0]);
+        /* take what got queued while we were waking up */
+        return 1 + msg_receive_many(buf + 1, max - 1, false);
+    }
+
+    irq_restore(state);
+    for (unsigned i = 0; IS_USED(MODULE_TRACE_EVENT_MSG) && (i < n); i++) {
+        _trace_msg(TRACE_EVENT_ID_MSG_RECV, buf[i].sender_pid, &buf[i]);
+    }
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return n;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
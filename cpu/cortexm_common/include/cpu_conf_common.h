@@ -69,6 +69,14 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Use the add-with-carry chain of inet_csum_arch.h for the Internet
+ *          Checksum on cores with Thumb-2 (ARMv7-M and ARMv8-M Mainline)
+ */
+#if defined(__thumb2__) || defined(DOXYGEN)
+#define INET_CSUM_HAS_ARCH_SUM32
+#endif
+
 /**
  * @name    ARM Cortex-M interrupt sub-priorities and PendSV priority
  * @{
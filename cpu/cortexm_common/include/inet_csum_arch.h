@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     cpu_cortexm_common
+ *
+ * @{
+ *
+ * @file
+ * @brief       Assembly implementation of the Internet Checksum inner loop
+ *
+ * Used by @ref net_inet_csum if @ref INET_CSUM_HAS_ARCH_SUM32 is defined.
+ */
+
+#ifndef INET_CSUM_ARCH_H
+#define INET_CSUM_ARCH_H
+#ifndef DOXYGEN
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Adds numof 32-bit words in host byte order to sum, the carry of every
+ * addition is fed into the next one by adcs, so only the final carry needs
+ * to be folded back. */
+static inline uint32_t inet_csum_arch_sum32(uint32_t sum, const void *words,
+                                            size_t numof)
+{
+    const uint32_t *w = words;
+    uint32_t tmp;
+
+    while (numof >= 4) {
+        __asm__ ("ldr   %[tmp], [%[w], #0]      \n"
+                 "adds  %[sum], %[sum], %[tmp]  \n"
+                 "ldr   %[tmp], [%[w], #4]      \n"
+                 "adcs  %[sum], %[sum], %[tmp]  \n"
+                 "ldr   %[tmp], [%[w], #8]      \n"
+                 "adcs  %[sum], %[sum], %[tmp]  \n"
+                 "ldr   %[tmp], [%[w], #12]     \n"
+                 "adcs  %[sum], %[sum], %[tmp]  \n"
+                 "adc   %[sum], %[sum], #0      \n"
+                 : [sum] "+r" (sum), [tmp] "=&r" (tmp)
+                 : [w] "r" (w), "m" (*(const uint32_t (*)[4])w)
+                 : "cc");
+        w += 4;
+        numof -= 4;
+    }
+    while (numof--) {
+        __asm__ ("ldr   %[tmp], [%[w]]          \n"
+                 "adds  %[sum], %[sum], %[tmp]  \n"
+                 "adc   %[sum], %[sum], #0      \n"
+                 : [sum] "+r" (sum), [tmp] "=&r" (tmp)
+                 : [w] "r" (w), "m" (*w)
+                 : "cc");
+        w++;
+    }
+    return sum;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DOXYGEN */
+#endif /* INET_CSUM_ARCH_H */
+/** @} */
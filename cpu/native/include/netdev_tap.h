@@ -42,6 +42,8 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+    bool rx_poll;                       /**< Flag for disabled RX interrupts,
+                                             see @ref NETOPT_RX_END_IRQ */
 } netdev_tap_t;
 
 /**
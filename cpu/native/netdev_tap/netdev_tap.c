@@ -62,6 +62,8 @@
 /* netdev interface */
 static int _init(netdev_t *netdev);
 static int _send(netdev_t *netdev, const iolist_t *iolist);
+static int _send_burst(netdev_t *netdev, const iolist_t *const frames[],
+                       unsigned numof);
 static int _recv(netdev_t *netdev, void *buf, size_t n, void *info);
 
 static inline void _get_mac_addr(netdev_t *netdev, uint8_t *dst)
@@ -89,14 +91,29 @@ static inline int _set_promiscuous(netdev_t *netdev, int value)
     return value;
 }
 
+static void _set_rx_irq(netdev_t *netdev, bool enable);
+
 static inline int _get_wired(netdev_t *netdev)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
     return dev->wired;
 }
 
+static bool _rx_pending(netdev_tap_t *dev);
+
 static inline void _isr(netdev_t *netdev)
 {
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    if (dev->rx_poll) {
+        /* polled by the upper layer, only signal actually pending frames */
+        _native_in_syscall++;
+        bool pending = _rx_pending(dev);
+        _native_in_syscall--;
+        if (!pending) {
+            return;
+        }
+    }
     if (netdev->event_callback) {
         netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
     }
@@ -125,6 +142,12 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscuous(dev);
             res = sizeof(bool);
             break;
+        case NETOPT_RX_END_IRQ:
+            *((netopt_enable_t *)value) =
+                container_of(dev, netdev_tap_t, netdev)->rx_poll
+                ? NETOPT_DISABLE : NETOPT_ENABLE;
+            res = sizeof(netopt_enable_t);
+            break;
         case NETOPT_IS_WIRED:
             if (!_get_wired(dev)) {
                 res = -ENOTSUP;
@@ -158,6 +181,10 @@ static int _set(netdev_t *dev, netopt_t opt, const void *value, size_t value_len
             _set_promiscuous(dev, ((const bool *)value)[0]);
             res = sizeof(netopt_enable_t);
             break;
+        case NETOPT_RX_END_IRQ:
+            _set_rx_irq(dev, *((const netopt_enable_t *)value) == NETOPT_ENABLE);
+            res = sizeof(netopt_enable_t);
+            break;
         default:
             res = netdev_eth_set(dev, opt, value, value_len);
             break;
@@ -173,6 +200,7 @@ static const netdev_driver_t netdev_driver_tap = {
     .isr = _isr,
     .get = _get,
     .set = _set,
+    .send_burst = _send_burst,
 };
 
 /* driver implementation */
@@ -188,18 +216,24 @@ static inline bool _is_addr_multicast(uint8_t *addr)
     return (addr[0] & 0x01);
 }
 
-static void _continue_reading(netdev_tap_t *dev)
+/* must be called with _native_in_syscall incremented */
+static bool _rx_pending(netdev_tap_t *dev)
 {
-    /* work around lost signals */
     fd_set rfds;
     struct timeval t;
     memset(&t, 0, sizeof(t));
     FD_ZERO(&rfds);
     FD_SET(dev->tap_fd, &rfds);
 
+    return real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1;
+}
+
+static void _continue_reading(netdev_tap_t *dev)
+{
+    /* work around lost signals */
     _native_in_syscall++; /* no switching here */
 
-    if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
+    if (_rx_pending(dev)) {
         int sig = SIGIO;
         extern int _sig_pipefd[2];
         extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
@@ -237,7 +271,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 
             real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
 
-            _continue_reading(dev);
+            if (!dev->rx_poll) {
+                _continue_reading(dev);
+            }
         }
 
         /* no way of figuring out packet size without racey buffering,
@@ -263,7 +299,9 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
             return 0;
         }
 
-        _continue_reading(dev);
+        if (!dev->rx_poll) {
+            _continue_reading(dev);
+        }
 
         return nread;
     }
@@ -301,6 +339,37 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
     return res;
 }
 
+static int _send_burst(netdev_t *netdev, const iolist_t *const frames[],
+                       unsigned numof)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+    int res = 0;
+    unsigned sent;
+
+    /* write all frames within a single syscall section, so no signal is
+     * handled (and no thread switched to) in between */
+    _native_syscall_enter();
+    for (sent = 0; sent < numof; sent++) {
+        struct iovec iov[iolist_count(frames[sent])];
+        unsigned n;
+
+        iolist_to_iovec(frames[sent], iov, &n);
+        res = real_writev(dev->tap_fd, iov, n);
+        if (res < 0) {
+            res = -errno;
+            break;
+        }
+    }
+    _native_syscall_leave();
+
+    if (netdev->event_callback) {
+        for (unsigned i = 0; i < sent; i++) {
+            netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
+        }
+    }
+    return (sent == 0) ? res : (int)sent;
+}
+
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params, int index) {
     dev->netdev.driver = &netdev_driver_tap;
     strncpy(dev->tap_name, *(params->tap_name), IFNAMSIZ - 1);
@@ -309,12 +378,27 @@ void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params, int
     netdev_register(&dev->netdev, NETDEV_TAP, index);
 }
 
+static void _set_rx_irq(netdev_t *netdev, bool enable)
+{
+    netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
+
+    dev->rx_poll = !enable;
+    if (enable) {
+        /* signal frames received while polled */
+        _continue_reading(dev);
+    }
+}
+
 static void _tap_isr(int fd, void *arg) {
     (void) fd;
 
     netdev_tap_t *dev = arg;
     netdev_t *netdev = &dev->netdev;
 
+    if (dev->rx_poll) {
+        /* RX interrupts are disabled, the upper layer polls */
+        return;
+    }
     if (netdev->event_callback) {
         netdev_trigger_event_isr(netdev);
     }
@@ -344,6 +428,7 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscuous = 0;
+    dev->rx_poll = false;
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
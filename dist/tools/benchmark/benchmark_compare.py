@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Collect the results of BENCHMARK_STATS_FUNC() from the output of one or more
+benchmark applications and compare them against a stored baseline.
+
+Store a baseline:
+
+    make -C tests/bench/sched_nop flash test | tee sched_nop.log
+    benchmark_compare.py --save baseline.json sched_nop.log
+
+Compare a later run against it:
+
+    benchmark_compare.py --baseline baseline.json sched_nop.log
+
+The exit code is 1 if the median of any benchmark grew by more than the
+threshold, 0 otherwise.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+RESULT_RE = re.compile(r'(\{"benchmark": .*\})\s*$')
+
+
+def parse(files):
+    results = {}
+    for file in files:
+        for line in file:
+            match = RESULT_RE.search(line)
+            if match is None:
+                continue
+            try:
+                result = json.loads(match.group(1))
+            except json.JSONDecodeError:
+                print("Ignoring malformed line: {}".format(line.strip()),
+                      file=sys.stderr)
+                continue
+            results[result["benchmark"]] = result
+    return results
+
+
+def compare(baseline, results, threshold, key):
+    regressions = 0
+    width = max((len(name) for name in results), default=0)
+    print("{:<{w}}  {:>12}  {:>12}  {:>8}".format(
+        "benchmark", "baseline", "current", "change", w=width))
+    for name, result in sorted(results.items()):
+        base = baseline.get(name)
+        if base is None:
+            print("{:<{w}}  {:>12}  {:>12.3f}  {:>8}".format(
+                name, "-", result[key], "new", w=width))
+            continue
+        if base["unit"] != result["unit"]:
+            print("{:<{w}}  unit changed from {} to {}".format(
+                name, base["unit"], result["unit"], w=width))
+            continue
+        change = 0.0
+        if base[key] > 0:
+            change = (result[key] - base[key]) * 100 / base[key]
+        mark = ""
+        if change > threshold:
+            mark = "  REGRESSION"
+            regressions += 1
+        print("{:<{w}}  {:>12.3f}  {:>12.3f}  {:>+7.1f}%{}".format(
+            name, base[key], result[key], change, mark, w=width))
+    for name in sorted(set(baseline) - set(results)):
+        print("{:<{w}}  missing in current results".format(name, w=width))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("logs", nargs="*", type=argparse.FileType("r"),
+                        default=[sys.stdin],
+                        help="output of benchmark applications "
+                             "(default: stdin)")
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("-s", "--save", metavar="BASELINE",
+                       help="store the results as baseline")
+    group.add_argument("-b", "--baseline", type=argparse.FileType("r"),
+                       help="compare the results against this baseline")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="allowed increase in percent (default: 5)")
+    parser.add_argument("-k", "--key", default="median",
+                        choices=("min", "median", "p99", "mean"),
+                        help="statistic to compare (default: median)")
+    args = parser.parse_args()
+
+    results = parse(args.logs)
+    if not results:
+        print("No benchmark results found", file=sys.stderr)
+        return 2
+    if args.save:
+        with open(args.save, "w") as file:
+            json.dump(results, file, indent=2, sort_keys=True)
+            file.write("\n")
+        print("Stored {} results in {}".format(len(results), args.save))
+        return 0
+    return 1 if compare(json.load(args.baseline), results,
+                        args.threshold, args.key) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
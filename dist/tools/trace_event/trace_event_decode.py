@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Convert events recorded by the trace_event module (see
+sys/include/trace_event.h) into the JSON trace event format, which is read
+by chrome://tracing and https://ui.perfetto.dev.
+
+Input is either the output of trace_event_dump() (e.g. a terminal log) or a
+file written by trace_event_dump_file() on native:
+
+    make -C tests/sys/trace_event flash term | tee trace.log
+    trace_event_decode.py trace.log -o trace.json
+"""
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"RIOTTEV1"
+RECORD = struct.Struct("<IIHBB")
+
+ID_THREAD = 1
+ID_ISR = 2
+ID_MSG_SEND = 3
+ID_MSG_RECV = 4
+
+CTX_ISR = 0xff
+
+KIND_PHASE = {0: "i", 1: "B", 2: "E"}
+
+RE_EVENT = re.compile(r"te (\d+) (\d+) (\d+) (\d+) (\d+)\s*$")
+RE_THREAD = re.compile(r"thread (\d+) (\S+)\s*$")
+RE_BEGIN = re.compile(r"trace_event: begin \d+ events")
+
+
+def parse_binary(data):
+    """Returns the events of a file written by trace_event_dump_file()"""
+    data = data[len(MAGIC):]
+    events = []
+    for i in range(len(data) // RECORD.size):
+        time, arg, eid, ctx, kind = RECORD.unpack_from(data, i * RECORD.size)
+        events.append((time, ctx, kind, eid, arg))
+    return events, {}
+
+
+def parse_text(text):
+    """Returns events and thread names of the last dump in a log"""
+    events = []
+    threads = {}
+    for line in text.splitlines():
+        if RE_BEGIN.search(line):
+            events = []
+            threads = {}
+            continue
+        match = RE_EVENT.search(line)
+        if match:
+            events.append(tuple(int(x) for x in match.groups()))
+            continue
+        match = RE_THREAD.search(line)
+        if match:
+            threads[int(match.group(1))] = match.group(2)
+    return events, threads
+
+
+def parse_names(path):
+    """Reads lines of "<event ID> <name>", the ID may be given in hex"""
+    names = {}
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                eid, name = line.split(None, 1)
+                names[int(eid, 0)] = name
+    return names
+
+
+def convert(events, threads, names):
+    out = []
+    tids = set()
+    for time, ctx, kind, eid, arg in events:
+        event = {"ts": time, "pid": 0, "ph": KIND_PHASE.get(kind, "i")}
+        if eid == ID_THREAD:
+            # recorded by the scheduler, the slice belongs to the thread
+            # given as argument
+            event["tid"] = arg
+            event["name"] = "running"
+        elif eid == ID_ISR:
+            event["tid"] = CTX_ISR
+            event["name"] = names.get(eid, "irq") + " {}".format(arg)
+        elif eid in (ID_MSG_SEND, ID_MSG_RECV):
+            event["tid"] = ctx
+            event["name"] = names.get(eid, "msg_send" if eid == ID_MSG_SEND
+                                      else "msg_recv")
+            event["args"] = {"peer": arg >> 16, "type": arg & 0xffff}
+        else:
+            event["tid"] = ctx
+            event["name"] = names.get(eid, "event {:#x}".format(eid))
+            event["args"] = {"arg": arg}
+        if event["ph"] == "i":
+            event["s"] = "t"
+        tids.add(event["tid"])
+        out.append(event)
+    # the ring buffer is filled in order of slot claims, which may differ
+    # from the order of time stamps when interrupted while recording
+    out.sort(key=lambda e: e["ts"])
+    for tid in sorted(tids):
+        if tid == CTX_ISR:
+            name = "ISR"
+        else:
+            name = "{} {}".format(tid, threads.get(tid, "thread"))
+        out.append({"ph": "M", "pid": 0, "tid": tid, "name": "thread_name",
+                    "args": {"name": name}})
+    return {"traceEvents": out}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="log with trace_event_dump() output "
+                        "or file written by trace_event_dump_file()")
+    parser.add_argument("-o", "--output", help="JSON output (default: stdout)")
+    parser.add_argument("--names", help="file with lines of "
+                        "\"<event ID> <name>\" naming application events")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    if data.startswith(MAGIC):
+        events, threads = parse_binary(data)
+    else:
+        events, threads = parse_text(data.decode(errors="replace"))
+    if not events:
+        sys.exit("{}: no events found".format(args.input))
+
+    names = parse_names(args.names) if args.names else {}
+    trace = convert(events, threads, names)
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+    else:
+        json.dump(trace, sys.stdout)
+        print()
+
+
+if __name__ == "__main__":
+    main()
@@ -19,6 +19,7 @@
  */
 
 #include <errno.h>
+#include <limits.h>
 #include <string.h>
 
 #include "mutex.h"
@@ -356,6 +357,45 @@ static int nd_recv(netdev_t *netdev, void *buf, size_t max_len, void *info)
     return (int)size;
 }
 
+static int nd_recv_alloc(netdev_t *netdev, netdev_rx_alloc_cb_t alloc,
+                         void *arg, void *info)
+{
+    enc28j60_t *dev = (enc28j60_t *)netdev;
+    uint8_t head[6];
+    uint16_t size;
+    uint16_t next;
+    uint8_t *buf;
+    int res;
+
+    (void)info;
+    mutex_lock(&dev->lock);
+
+    /* read the packet header only once, the packet size is known afterwards */
+    uint16_t rx_rd_ptr = cmd_r_addr(dev, ADDR_RX_READ);
+    cmd_w_addr(dev, ADDR_READ_PTR, ERXRDPT_TO_NEXT(rx_rd_ptr));
+    cmd_rbm(dev, head, 6);
+    next = (uint16_t)((head[1] << 8) | head[0]);
+    size = (uint16_t)((head[3] << 8) | head[2]) - 4;  /* discard CRC */
+
+    DEBUG("[enc28j60] recv_alloc: size=%i next=%i\n", (int)size, (int)next);
+
+    buf = alloc(arg, size);
+    if (buf != NULL) {
+        cmd_rbm(dev, buf, size);
+        res = size;
+    }
+    else {
+        DEBUG("[enc28j60] recv_alloc: drop packet - no buffer to receive\n");
+        res = -ENOBUFS;
+    }
+    /* release memory */
+    cmd_w_addr(dev, ADDR_RX_READ, NEXT_TO_ERXRDPT(next));
+    cmd_bfs(dev, REG_ECON2, -1, ECON2_PKTDEC);
+
+    mutex_unlock(&dev->lock);
+    return res;
+}
+
 static int nd_init(netdev_t *netdev)
 {
     enc28j60_t *dev = (enc28j60_t *)netdev;
@@ -448,12 +488,15 @@ static int nd_init(netdev_t *netdev)
 /**
  * PKTIF does not reliably report the status of pending packets.
  * Checking EPKTCNT is the suggested workaround.
- * Returns the number of pending packets.
+ * Signals up to max pending packets and returns their number.
  */
-static int rx_interrupt(netdev_t *netdev)
+static int rx_interrupt(netdev_t *netdev, int max)
 {
     enc28j60_t *dev = (enc28j60_t *)netdev;
     int pkg_cnt = cmd_rcr(dev, REG_B1_EPKTCNT, 1);
+    if (pkg_cnt > max) {
+        pkg_cnt = max;
+    }
     int ret = pkg_cnt;
     while (pkg_cnt-- > 0) {
         DEBUG("[enc28j60] isr: packet received\n");
@@ -469,6 +512,8 @@ static void nd_isr(netdev_t *netdev)
     /* disable global interrupt enable bit to avoid losing interrupts */
     cmd_bfc(dev, REG_EIE, -1, EIE_INTIE);
 
+    /* when polled, signal a single packet per call (see NETOPT_RX_END_IRQ) */
+    int rx_max = dev->rx_poll ? 1 : INT_MAX;
     uint8_t eir;
     int loop;
     do {
@@ -489,8 +534,14 @@ static void nd_isr(netdev_t *netdev)
                 netdev->event_callback(netdev, NETDEV_EVENT_LINK_DOWN);
             }
         }
-        if (rx_interrupt(netdev)) {
-            loop++;
+        if (rx_max > 0) {
+            int rx = rx_interrupt(netdev, rx_max);
+            if (rx > 0) {
+                loop++;
+                if (dev->rx_poll) {
+                    rx_max -= rx;
+                }
+            }
         }
         if (eir & EIR_RXERIF) {
             loop++;
@@ -545,6 +596,17 @@ static int nd_set(netdev_t *netdev, netopt_t opt, const void *value, size_t valu
             assert(value_len == ETHERNET_ADDR_LEN);
             mac_set(dev, (uint8_t *)value);
             return ETHERNET_ADDR_LEN;
+        case NETOPT_RX_END_IRQ:
+            assert(value_len == sizeof(netopt_enable_t));
+            /* nd_isr() checks the packet counter regardless of PKTIE */
+            dev->rx_poll = (*((const netopt_enable_t *)value) != NETOPT_ENABLE);
+            if (dev->rx_poll) {
+                cmd_bfc(dev, REG_EIE, -1, EIE_PKTIE);
+            }
+            else {
+                cmd_bfs(dev, REG_EIE, -1, EIE_PKTIE);
+            }
+            return sizeof(netopt_enable_t);
         default:
             return netdev_eth_set(netdev, opt, value, value_len);
     }
@@ -557,6 +619,7 @@ static const netdev_driver_t netdev_driver_enc28j60 = {
     .isr = nd_isr,
     .get = nd_get,
     .set = nd_set,
+    .recv_alloc = nd_recv_alloc,
 };
 
 void enc28j60_setup(enc28j60_t *dev, const enc28j60_params_t *params, uint8_t index)
@@ -565,6 +628,7 @@ void enc28j60_setup(enc28j60_t *dev, const enc28j60_params_t *params, uint8_t in
     dev->p = *params;
     mutex_init(&dev->lock);
     dev->tx_time = 0;
+    dev->rx_poll = false;
 
     netdev_register(&dev->netdev, NETDEV_ENC28J60, index);
 }
@@ -22,6 +22,7 @@
 #ifndef ENC28J60_H
 #define ENC28J60_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "mutex.h"
@@ -51,6 +52,7 @@ typedef struct {
     enc28j60_params_t p;    /**< SPI and pin confiuration */
     mutex_t lock;           /**< lock the device on access */
     uint32_t tx_time;       /**< last transmission time for timeout handling */
+    bool rx_poll;           /**< RX interrupt disabled, see @ref NETOPT_RX_END_IRQ */
 } enc28j60_t;
 
 /**
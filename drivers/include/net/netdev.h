@@ -87,6 +87,12 @@
  * the data needs to contain a pre-filled link layer header as e.g. an
  * IEEE802.15.4 or Ethernet header.
  *
+ * Multiple frames ready for transmission can be passed at once with
+ * @ref netdev_send_burst(). Drivers implementing
+ * @ref netdev_driver_t::send_burst "send_burst()" transmit them back to back,
+ * for all other drivers they are passed to
+ * @ref netdev_driver_t::send "send()" one after another.
+ *
  * Receiving data using the `netdev` interface requires typically four steps:
  * 1. wait for a @ref NETDEV_EVENT_RX_COMPLETE event
  * 2. call the @ref netdev_driver_t::recv "recv()" function with `buf := NULL`
@@ -98,6 +104,15 @@
  * This receive sequence can of course be simplified by skipping steps 2 and 3
  * when using fixed sized pre-allocated buffers or similar means. *
  *
+ * Drivers that have to fetch a frame header from the device to learn the
+ * frame size (e.g. the enc28j60 over SPI) may additionally implement
+ * @ref netdev_driver_t::recv_alloc "recv_alloc()", which merges steps 2 to 4
+ * into a single call: the driver obtains the frame size once, asks the caller
+ * for a buffer of that size through a callback and reads the frame into it.
+ * This saves the repeated header transfer only; drivers that know the frame
+ * size without a bus access gain nothing from it. @ref netdev_recv_alloc()
+ * uses it if available and falls back to the sequence above otherwise.
+ *
  * @note    The @ref netdev_driver_t::send "send()" and
  *          @ref netdev_driver_t::recv "recv()" functions **must** never be
  *          called from interrupt context.
@@ -294,6 +309,19 @@ typedef struct netdev netdev_t;
  */
 typedef void (*netdev_event_cb_t)(netdev_t *dev, netdev_event_t event);
 
+/**
+ * @brief   Allocates the buffer a received frame is read into
+ *
+ * @see     netdev_driver_t::recv_alloc
+ *
+ * @param[in] arg   argument given to @ref netdev_driver_t::recv_alloc
+ * @param[in] len   size of the received frame (or an upper bound estimation)
+ *
+ * @return  buffer of at least @p len bytes
+ * @return  NULL if no buffer is available, the frame is dropped
+ */
+typedef void *(*netdev_rx_alloc_cb_t)(void *arg, size_t len);
+
 /**
  * @brief   Driver types for netdev.
  *
@@ -598,8 +626,142 @@ typedef struct netdev_driver {
      */
     int (*set)(netdev_t *dev, netopt_t opt,
                const void *value, size_t value_len);
+
+    /**
+     * @brief   Get a received frame into a buffer allocated on demand
+     *
+     * @pre     `(dev != NULL) && (alloc != NULL)`
+     *
+     * Optional, may be NULL. Use @ref netdev_recv_alloc() to call it. Only
+     * worth implementing if querying the frame size costs a bus transfer.
+     *
+     * Equivalent to calling @ref netdev_driver_t::recv "recv()" to get the
+     * frame size, allocating a buffer and calling
+     * @ref netdev_driver_t::recv "recv()" again, but the driver accesses the
+     * device only once: it determines the frame size, calls @p alloc exactly
+     * once with it and reads the frame into the returned buffer. If @p alloc
+     * returns NULL, the frame is dropped.
+     *
+     * @param[in]   dev     network device descriptor. Must not be NULL.
+     * @param[in]   alloc   allocates the buffer for the frame
+     * @param[in]   arg     argument for @p alloc
+     * @param[out]  info    status information for the received frame. Might
+     *                      be of different type for different netdev devices.
+     *                      May be NULL if not needed or applicable.
+     *
+     * @retval  -ENOBUFS    if @p alloc returned NULL
+     * @retval  <0          on other errors
+     * @retval  0           if no frame was received or the frame was dropped
+     *                      by the driver
+     *
+     * If the return value is not positive, the caller still owns the buffer
+     * returned by @p alloc, if it was called.
+     * @return  number of bytes read into the buffer (may be less than the
+     *          size given to @p alloc)
+     */
+    int (*recv_alloc)(netdev_t *dev, netdev_rx_alloc_cb_t alloc, void *arg,
+                      void *info);
+
+    /**
+     * @brief   Send multiple frames back to back
+     *
+     * @pre     `(dev != NULL) && (frames != NULL) && (numof > 0)`
+     *
+     * Optional, may be NULL. Use @ref netdev_send_burst() to call it. Only
+     * supported for drivers using the legacy API, i.e. with
+     * @ref netdev_driver_t::confirm_send "confirm_send()" being NULL.
+     *
+     * Equivalent to calling @ref netdev_driver_t::send "send()" for every
+     * frame, but allows the driver to hand all frames to the device before
+     * waiting for the completion of the first one (e.g. by filling multiple
+     * entries of a DMA descriptor ring). The driver signals
+     * @ref NETDEV_EVENT_TX_COMPLETE for every frame transmitted.
+     *
+     * The driver may stop early, e.g. if it has no room for further frames.
+     * All frames after the ones transmitted were not sent.
+     *
+     * @param[in] dev       Network device descriptor. Must not be NULL.
+     * @param[in] frames    Frames to send, in the format of
+     *                      @ref netdev_driver_t::send "send()"
+     * @param[in] numof     Number of frames in @p frames
+     *
+     * @retval  <0          Error sending the first frame
+     * @return  Number of frames transmitted, starting with the first one
+     */
+    int (*send_burst)(netdev_t *dev, const iolist_t *const frames[],
+                      unsigned numof);
 } netdev_driver_t;
 
+/**
+ * @brief   Gets a received frame into a buffer allocated on demand
+ *
+ * Calls @ref netdev_driver_t::recv_alloc "recv_alloc()" if the driver
+ * provides it and the usual sequence of @ref netdev_driver_t::recv "recv()"
+ * calls otherwise. See @ref netdev_driver_t::recv_alloc for the parameters
+ * and return values.
+ *
+ * @param[in]   dev     network device descriptor. Must not be NULL.
+ * @param[in]   alloc   allocates the buffer for the frame
+ * @param[in]   arg     argument for @p alloc
+ * @param[out]  info    status information for the received frame
+ *
+ * @return  see @ref netdev_driver_t::recv_alloc
+ */
+static inline int netdev_recv_alloc(netdev_t *dev, netdev_rx_alloc_cb_t alloc,
+                                    void *arg, void *info)
+{
+    if (dev->driver->recv_alloc != NULL) {
+        return dev->driver->recv_alloc(dev, alloc, arg, info);
+    }
+
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
+
+    if (len <= 0) {
+        return len;
+    }
+
+    void *buf = alloc(arg, len);
+
+    if (buf == NULL) {
+        /* drop the frame */
+        dev->driver->recv(dev, NULL, len, NULL);
+        return -ENOBUFS;
+    }
+    return dev->driver->recv(dev, buf, len, info);
+}
+
+/**
+ * @brief   Sends multiple frames back to back
+ *
+ * Calls @ref netdev_driver_t::send_burst "send_burst()" if the driver
+ * provides it and @ref netdev_driver_t::send "send()" for each frame
+ * otherwise, stopping at the first error. See
+ * @ref netdev_driver_t::send_burst for the parameters and return values.
+ *
+ * @param[in] dev       network device descriptor. Must not be NULL.
+ * @param[in] frames    frames to send
+ * @param[in] numof     number of frames in @p frames
+ *
+ * @return  see @ref netdev_driver_t::send_burst
+ */
+static inline int netdev_send_burst(netdev_t *dev,
+                                    const iolist_t *const frames[],
+                                    unsigned numof)
+{
+    if (dev->driver->send_burst != NULL) {
+        return dev->driver->send_burst(dev, frames, numof);
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        int res = dev->driver->send(dev, frames[i]);
+
+        if (res < 0) {
+            return (i == 0) ? res : (int)i;
+        }
+    }
+    return numof;
+}
+
 /**
  * @brief   Convenience function for declaring get() as not supported in general
  *
@@ -0,0 +1,199 @@
+/* Generated file do not edit */
+#define DEVELHELP 1
+#undef _FORTIFY_SOURCE
+#define DEBUG_ASSERT_VERBOSE 1
+#define RIOT_APPLICATION "gnrc_networking"
+#define BOARD_NATIVE "native"
+#define RIOT_BOARD BOARD_NATIVE
+#define CPU_NATIVE "native"
+#define RIOT_CPU CPU_NATIVE
+#define MCU_NATIVE "native"
+#define RIOT_MCU MCU_NATIVE
+#define SOCK_HAS_IPV6 1
+#define RIOT_VERSION "c078"
+#define RIOT_VERSION_CODE RIOT_VERSION_NUM(2042,5,23,0)
+#define MODULE_ATOMIC_UTILS 1
+#define MODULE_AUTO_INIT 1
+#define MODULE_AUTO_INIT_GNRC_IPV6 1
+#define MODULE_AUTO_INIT_GNRC_IPV6_NIB 1
+#define MODULE_AUTO_INIT_GNRC_NETIF 1
+#define MODULE_AUTO_INIT_GNRC_PKTBUF 1
+#define MODULE_AUTO_INIT_GNRC_PKTDUMP 1
+#define MODULE_AUTO_INIT_GNRC_RPL 1
+#define MODULE_AUTO_INIT_GNRC_SIXLOWPAN 1
+#define MODULE_AUTO_INIT_GNRC_TCP 1
+#define MODULE_AUTO_INIT_GNRC_UDP 1
+#define MODULE_AUTO_INIT_RANDOM 1
+#define MODULE_AUTO_INIT_ZTIMER 1
+#define MODULE_BOARD 1
+#define MODULE_BOARD_COMMON_INIT 1
+#define MODULE_CONGURE 1
+#define MODULE_CONGURE_RENO 1
+#define MODULE_CONGURE_RENO_METHODS 1
+#define MODULE_CORE 1
+#define MODULE_CORE_IDLE_THREAD 1
+#define MODULE_CORE_INIT 1
+#define MODULE_CORE_LIB 1
+#define MODULE_CORE_MBOX 1
+#define MODULE_CORE_MSG 1
+#define MODULE_CORE_PANIC 1
+#define MODULE_CORE_THREAD 1
+#define MODULE_CORE_THREAD_FLAGS 1
+#define MODULE_CPU 1
+#define MODULE_CRYPTO 1
+#define MODULE_CRYPTO_AES_128 1
+#define MODULE_DIV 1
+#define MODULE_EUI_PROVIDER 1
+#define MODULE_EVENT 1
+#define MODULE_EVTIMER 1
+#define MODULE_EVTIMER_MBOX 1
+#define MODULE_FMT 1
+#define MODULE_FRAC 1
+#define MODULE_GNRC 1
+#define MODULE_GNRC_ICMPV6 1
+#define MODULE_GNRC_ICMPV6_ECHO 1
+#define MODULE_GNRC_ICMPV6_ERROR 1
+#define MODULE_GNRC_IPV6 1
+#define MODULE_GNRC_IPV6_HDR 1
+#define MODULE_GNRC_IPV6_NIB 1
+#define MODULE_GNRC_IPV6_NIB_RIO 1
+#define MODULE_GNRC_IPV6_NIB_ROUTER 1
+#define MODULE_GNRC_IPV6_ROUTER 1
+#define MODULE_GNRC_IPV6_ROUTER_DEFAULT 1
+#define MODULE_GNRC_NDP 1
+#define MODULE_GNRC_NETAPI 1
+#define MODULE_GNRC_NETAPI_MBOX 1
+#define MODULE_GNRC_NETIF 1
+#define MODULE_GNRC_NETIF_6LO 1
+#define MODULE_GNRC_NETIF_ETHERNET 1
+#define MODULE_GNRC_NETIF_EVENTS 1
+#define MODULE_GNRC_NETIF_HDR 1
+#define MODULE_GNRC_NETIF_INIT_DEVS 1
+#define MODULE_GNRC_NETIF_IPV6 1
+#define MODULE_GNRC_NETIF_RX_POLL 1
+#define MODULE_GNRC_NETIF_TX_BURST 1
+#define MODULE_GNRC_NETREG 1
+#define MODULE_GNRC_NETTYPE_ICMPV6 1
+#define MODULE_GNRC_NETTYPE_IPV6 1
+#define MODULE_GNRC_NETTYPE_SIXLOWPAN 1
+#define MODULE_GNRC_NETTYPE_TCP 1
+#define MODULE_GNRC_NETTYPE_UDP 1
+#define MODULE_GNRC_PKT 1
+#define MODULE_GNRC_PKTBUF 1
+#define MODULE_GNRC_PKTBUF_STATIC 1
+#define MODULE_GNRC_PKTDUMP 1
+#define MODULE_GNRC_PKTLAT 1
+#define MODULE_GNRC_RPL 1
+#define MODULE_GNRC_RX_FASTPATH 1
+#define MODULE_GNRC_SIXLOWPAN 1
+#define MODULE_GNRC_SIXLOWPAN_CTX 1
+#define MODULE_GNRC_SIXLOWPAN_FRAG_FB 1
+#define MODULE_GNRC_SIXLOWPAN_FRAG_RB 1
+#define MODULE_GNRC_SIXLOWPAN_FRAG_VRB 1
+#define MODULE_GNRC_SIXLOWPAN_IPHC 1
+#define MODULE_GNRC_SIXLOWPAN_IPHC_CACHE 1
+#define MODULE_GNRC_SIXLOWPAN_IPHC_NHC 1
+#define MODULE_GNRC_SOCK 1
+#define MODULE_GNRC_SOCK_UDP 1
+#define MODULE_GNRC_TCP 1
+#define MODULE_GNRC_TCP_CONGURE 1
+#define MODULE_GNRC_TCP_CONGURE_RENO 1
+#define MODULE_GNRC_TCP_FASTOPEN 1
+#define MODULE_GNRC_UDP 1
+#define MODULE_HASHES 1
+#define MODULE_ICMPV6 1
+#define MODULE_INET_CSUM 1
+#define MODULE_IOLIST 1
+#define MODULE_IPV6 1
+#define MODULE_IPV6_ADDR 1
+#define MODULE_IPV6_HDR 1
+#define MODULE_L2UTIL 1
+#define MODULE_LIBC 1
+#define MODULE_LUID 1
+#define MODULE_NATIVE_CLI_EUI_PROVIDER 1
+#define MODULE_NATIVE_DRIVERS 1
+#define MODULE_NETDEV 1
+#define MODULE_NETDEV_DEFAULT 1
+#define MODULE_NETDEV_ETH 1
+#define MODULE_NETDEV_REGISTER 1
+#define MODULE_NETDEV_TAP 1
+#define MODULE_NETIF 1
+#define MODULE_NETSTATS 1
+#define MODULE_NETSTATS_IPV6 1
+#define MODULE_NETSTATS_L2 1
+#define MODULE_NETSTATS_RPL 1
+#define MODULE_NETUTILS 1
+#define MODULE_OD 1
+#define MODULE_PERIPH 1
+#define MODULE_PERIPH_COMMON 1
+#define MODULE_PERIPH_CPUID 1
+#define MODULE_PERIPH_GPIO 1
+#define MODULE_PERIPH_GPIO_LINUX 1
+#define MODULE_PERIPH_HWRNG 1
+#define MODULE_PERIPH_INIT 1
+#define MODULE_PERIPH_INIT_CPUID 1
+#define MODULE_PERIPH_INIT_GPIO 1
+#define MODULE_PERIPH_INIT_GPIO_LINUX 1
+#define MODULE_PERIPH_INIT_HWRNG 1
+#define MODULE_PERIPH_INIT_LED0 1
+#define MODULE_PERIPH_INIT_LED1 1
+#define MODULE_PERIPH_INIT_LED2 1
+#define MODULE_PERIPH_INIT_LED3 1
+#define MODULE_PERIPH_INIT_LED4 1
+#define MODULE_PERIPH_INIT_LED5 1
+#define MODULE_PERIPH_INIT_LED6 1
+#define MODULE_PERIPH_INIT_LED7 1
+#define MODULE_PERIPH_INIT_LEDS 1
+#define MODULE_PERIPH_INIT_PM 1
+#define MODULE_PERIPH_INIT_TIMER 1
+#define MODULE_PERIPH_INIT_UART 1
+#define MODULE_PERIPH_PM 1
+#define MODULE_PERIPH_TIMER 1
+#define MODULE_PERIPH_UART 1
+#define MODULE_PREPROCESSOR 1
+#define MODULE_PREPROCESSOR_SUCCESSOR 1
+#define MODULE_PRNG 1
+#define MODULE_PRNG_MUSL_LCG 1
+#define MODULE_PS 1
+#define MODULE_RANDOM 1
+#define MODULE_SCHED_CB 1
+#define MODULE_SCHED_WAKEUP_CALLBACK 1
+#define MODULE_SCHEDSTATISTICS 1
+#define MODULE_SCHEDSTATISTICS_LATENCY 1
+#define MODULE_SEQ 1
+#define MODULE_SHELL 1
+#define MODULE_SHELL_CMD_GNRC_ICMPV6_ECHO 1
+#define MODULE_SHELL_CMD_GNRC_IPV6_NIB 1
+#define MODULE_SHELL_CMD_GNRC_NETIF 1
+#define MODULE_SHELL_CMD_GNRC_PKTLAT 1
+#define MODULE_SHELL_CMD_GNRC_RPL 1
+#define MODULE_SHELL_CMD_GNRC_SIXLOWPAN_CTX 1
+#define MODULE_SHELL_CMD_GNRC_UDP 1
+#define MODULE_SHELL_CMD_PM 1
+#define MODULE_SHELL_CMD_PS 1
+#define MODULE_SHELL_CMD_SYS 1
+#define MODULE_SHELL_CMDS 1
+#define MODULE_SHELL_CMDS_DEFAULT 1
+#define MODULE_SIXLOWPAN 1
+#define MODULE_SOCK 1
+#define MODULE_STDIN 1
+#define MODULE_STDIO_NATIVE 1
+#define MODULE_SYS 1
+#define MODULE_TCP 1
+#define MODULE_TRACE_EVENT 1
+#define MODULE_TRACE_EVENT_MSG 1
+#define MODULE_TRACE_EVENT_SCHED 1
+#define MODULE_TRICKLE 1
+#define MODULE_UDP 1
+#define MODULE_XTIMER 1
+#define MODULE_ZTIMER 1
+#define MODULE_ZTIMER_CONVERT 1
+#define MODULE_ZTIMER_CONVERT_FRAC 1
+#define MODULE_ZTIMER_CONVERT_SHIFT 1
+#define MODULE_ZTIMER_CORE 1
+#define MODULE_ZTIMER_EXTEND 1
+#define MODULE_ZTIMER_INIT 1
+#define MODULE_ZTIMER_MSEC 1
+#define MODULE_ZTIMER_PERIPH_TIMER 1
+#define MODULE_ZTIMER_USEC 1
+#define MODULE_ZTIMER_XTIMER_COMPAT 1
@@ -123,6 +123,7 @@ PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
+PSEUDOMODULES += gnrc_netif_tx_burst
 ## @defgroup net_gnrc_pktbuf_cmd  gnrc_pktbuf_cmd
 ## @ingroup net_gnrc_pktbuf
 ## @{
@@ -216,6 +217,12 @@ PSEUDOMODULES += gnrc_nettype_udp
 ## @}
 
 
+## @addtogroup net_gnrc_ipv6
+## @{
+## Carry received UDP datagrams from the network interface to the socket
+## without the IPv6 and UDP threads, see @ref gnrc_ipv6_receive_fastpath
+PSEUDOMODULES += gnrc_rx_fastpath
+## @}
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -255,6 +262,7 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_quic
 PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 ## @}
 ## @}
+PSEUDOMODULES += gnrc_sixlowpan_iphc_cache
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
@@ -267,6 +275,28 @@ PSEUDOMODULES += gnrc_udp_cmd
 ## @}
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+##
+## @addtogroup net_gnrc_tcp_congure
+## @{
+##
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_abe gnrc_tcp_congure_abe: TCP Reno with ABE
+## @brief  Provides @ref gnrc_tcp_congure_abe_setup() for GNRC TCP using [TCP Reno with ABE](@ref sys_congure_abe)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_abe
+## @}
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @brief  Provides @ref gnrc_tcp_congure_reno_setup() for GNRC TCP using [TCP Reno](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @}
+## @defgroup net_gnrc_tcp_fastopen gnrc_tcp_fastopen: TCP Fast Open
+## @ingroup net_gnrc_tcp
+## @brief  Send and accept data in the SYN of a connection (RFC 7413), see @ref gnrc_tcp_open_fastopen()
+## @{
+PSEUDOMODULES += gnrc_tcp_fastopen
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 ## @defgroup pseudomodule_heap_cmd heap_cmd
 ## @ingroup sys_shell_commands
@@ -407,6 +437,8 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_wakeup_callback
+PSEUDOMODULES += schedstatistics_latency
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -466,6 +498,7 @@ PSEUDOMODULES += shell_cmd_gnrc_netif
 PSEUDOMODULES += shell_cmd_gnrc_netif_lora
 PSEUDOMODULES += shell_cmd_gnrc_netif_lorawan
 PSEUDOMODULES += shell_cmd_gnrc_pktbuf
+PSEUDOMODULES += shell_cmd_gnrc_pktlat
 PSEUDOMODULES += shell_cmd_gnrc_rpl
 PSEUDOMODULES += shell_cmd_gnrc_sixlowpan_ctx
 PSEUDOMODULES += shell_cmd_gnrc_sixlowpan_frag_stats
@@ -544,6 +577,9 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+PSEUDOMODULES += trace_event_isr
+PSEUDOMODULES += trace_event_msg
+PSEUDOMODULES += trace_event_sched
 PSEUDOMODULES += usbus_urb
 PSEUDOMODULES += vdd_lc_filter_%
 ## @defgroup pseudomodule_vfs_auto_format vfs_auto_format
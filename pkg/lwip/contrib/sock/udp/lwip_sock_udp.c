@@ -100,6 +100,33 @@ ssize_t sock_udp_recv_aux(sock_udp_t *sock, void *data, size_t max_len,
     return (nobufs) ? -ENOBUFS : ((res < 0) ? res : ret);
 }
 
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, size_t num,
+                           uint32_t timeout)
+{
+    ssize_t res;
+    size_t i = 0;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    /* only wait for the first datagram */
+    res = sock_udp_recv(sock, msgs[0].data, msgs[0].len, timeout, msgs[0].remote);
+    if (res < 0) {
+        return res;
+    }
+    msgs[i++].msg_len = res;
+    /* take the others from the receive mbox without blocking */
+    while (i < num) {
+        res = sock_udp_recv(sock, msgs[i].data, msgs[i].len, 0, msgs[i].remote);
+        if (res >= 0) {
+            msgs[i++].msg_len = res;
+        }
+        else if ((res != -ENOBUFS) && (res != -EPROTO)) {
+            /* no more datagrams queued */
+            break;
+        }
+    }
+    return i;
+}
+
 ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **ctx,
                               uint32_t timeout, sock_udp_ep_t *remote,
                               sock_udp_aux_rx_t *aux)
@@ -65,6 +65,11 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_TRACE_EVENT)
+extern void auto_init_trace_event(void);
+AUTO_INIT(auto_init_trace_event,
+          AUTO_INIT_PRIO_MOD_TRACE_EVENT);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
@@ -100,6 +105,11 @@ extern void gnrc_pktbuf_init(void);
 AUTO_INIT(gnrc_pktbuf_init,
           AUTO_INIT_PRIO_MOD_GNRC_PKTBUF);
 #endif
+#if IS_USED(MODULE_GNRC_PKTLAT)
+extern void gnrc_pktlat_init(void);
+AUTO_INIT(gnrc_pktlat_init,
+          AUTO_INIT_PRIO_MOD_GNRC_PKTLAT);
+#endif
 #if IS_USED(MODULE_AUTO_INIT_GNRC_PKTDUMP)
 extern void gnrc_pktdump_init(void);
 AUTO_INIT(gnrc_pktdump_init,
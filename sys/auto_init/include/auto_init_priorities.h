@@ -59,6 +59,13 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE_EVENT
+/**
+ * @brief   structured tracing priority, after scheduling statistics to chain
+ *          its scheduler callback
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE_EVENT                  1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -107,6 +114,12 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_GNRC_PKTBUF                  1120
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_GNRC_PKTLAT
+/**
+ * @brief   GNRC packet latency priority
+ */
+#define AUTO_INIT_PRIO_MOD_GNRC_PKTLAT                  1125
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_GNRC_PKTDUMP
 /**
  * @brief   GNRC pktdump priority
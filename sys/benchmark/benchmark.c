@@ -18,11 +18,18 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "timex.h"
 
 #include "benchmark.h"
 
+#if defined(CPU_NATIVE)
+#include <time.h>
+#elif defined(MODULE_CORTEXM_COMMON)
+#include "cpu.h"
+#endif
+
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
     uint32_t full = (time / runs);
@@ -35,3 +42,176 @@ void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
            "  ---  %9" PRIu32 " calls per sec\n",
            name, time, full, div, per_sec);
 }
+
+#if defined(CPU_NATIVE) && (defined(__i386__) || defined(__x86_64__))
+void benchmark_clock_init(void)
+{
+}
+
+uint32_t benchmark_clock_now(void)
+{
+    return (uint32_t)__builtin_ia32_rdtsc();
+}
+
+const char *benchmark_clock_unit(void)
+{
+    return "cycles";
+}
+#elif defined(CPU_NATIVE)
+void benchmark_clock_init(void)
+{
+}
+
+uint32_t benchmark_clock_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+const char *benchmark_clock_unit(void)
+{
+    return "ns";
+}
+#else
+#if defined(MODULE_CORTEXM_COMMON) && defined(DWT_CTRL_CYCCNTENA_Msk)
+static bool _has_cyccnt(void)
+{
+    return !(DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk);
+}
+#else
+static inline bool _has_cyccnt(void)
+{
+    return false;
+}
+#endif
+
+void benchmark_clock_init(void)
+{
+    static bool ztimer_acquired;
+
+#if defined(MODULE_CORTEXM_COMMON) && defined(DWT_CTRL_CYCCNTENA_Msk)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    if (_has_cyccnt()) {
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+#endif
+    /* ztimer_now() requires the fallback clock to be acquired */
+    if (!_has_cyccnt() && !ztimer_acquired) {
+        ztimer_acquire(ZTIMER_USEC);
+        ztimer_acquired = true;
+    }
+}
+
+uint32_t benchmark_clock_now(void)
+{
+#if defined(MODULE_CORTEXM_COMMON) && defined(DWT_CTRL_CYCCNTENA_Msk)
+    if (_has_cyccnt()) {
+        return DWT->CYCCNT;
+    }
+#endif
+    return ztimer_now(ZTIMER_USEC);
+}
+
+const char *benchmark_clock_unit(void)
+{
+    return _has_cyccnt() ? "cycles" : "us";
+}
+#endif
+
+static void _sort(uint32_t *samples, unsigned numof)
+{
+    for (unsigned i = 1; i < numof; i++) {
+        uint32_t tmp = samples[i];
+        unsigned j = i;
+
+        for (; (j > 0) && (samples[j - 1] > tmp); j--) {
+            samples[j] = samples[j - 1];
+        }
+        samples[j] = tmp;
+    }
+}
+
+static uint64_t _sqrt(uint64_t x)
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit) {
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static inline uint64_t _per_call(uint64_t time, unsigned long runs)
+{
+    return (time * 1000 + (runs / 2)) / runs;
+}
+
+void benchmark_calc_stats(benchmark_stats_t *stats, unsigned long runs,
+                          uint32_t *samples, unsigned numof)
+{
+    uint64_t sum = 0, var = 0, mean;
+
+    _sort(samples, numof);
+    for (unsigned i = 0; i < numof; i++) {
+        sum += samples[i];
+    }
+    mean = (sum + (numof / 2)) / numof;
+    for (unsigned i = 0; i < numof; i++) {
+        int64_t diff = (int64_t)samples[i] - (int64_t)mean;
+
+        var += diff * diff;
+    }
+    stats->min = _per_call(samples[0], runs);
+    if (numof & 1) {
+        stats->median = _per_call(samples[numof / 2], runs);
+    }
+    else {
+        stats->median = _per_call((uint64_t)samples[numof / 2 - 1] +
+                                  samples[numof / 2], runs) / 2;
+    }
+    /* nearest rank */
+    stats->p99 = _per_call(samples[(numof * 99 + 99) / 100 - 1], runs);
+    stats->mean = _per_call(sum, runs * numof);
+    stats->stddev = _per_call(_sqrt(var / numof), runs);
+}
+
+static void _print_val(const char *key, uint64_t val)
+{
+    printf(", \"%s\": %" PRIu32 ".%03u", key, (uint32_t)(val / 1000),
+           (unsigned)(val % 1000));
+}
+
+void benchmark_print_stats(const char *name, unsigned long runs,
+                           uint32_t *samples, unsigned numof)
+{
+    benchmark_stats_t stats;
+    const char *unit = benchmark_clock_unit();
+
+    benchmark_calc_stats(&stats, runs, samples, numof);
+    printf("%25s: %7" PRIu32 ".%03u %s per call (median)"
+           "  ---  p99 %7" PRIu32 ".%03u  ---  stddev %5" PRIu32 ".%03u\n",
+           name, (uint32_t)(stats.median / 1000), (unsigned)(stats.median % 1000),
+           unit, (uint32_t)(stats.p99 / 1000), (unsigned)(stats.p99 % 1000),
+           (uint32_t)(stats.stddev / 1000), (unsigned)(stats.stddev % 1000));
+    printf("{\"benchmark\": \"%s\", \"unit\": \"%s\", \"runs\": %lu, "
+           "\"samples\": %u", name, unit, runs, numof);
+    _print_val("min", stats.min);
+    _print_val("median", stats.median);
+    _print_val("p99", stats.p99);
+    _print_val("mean", stats.mean);
+    _print_val("stddev", stats.stddev);
+    puts("}");
+}
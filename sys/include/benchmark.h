@@ -10,6 +10,25 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_FUNC() runs a function call a given number of times and
+ * prints the average runtime per call, measured with @ref ZTIMER_USEC.
+ *
+ * @ref BENCHMARK_STATS_FUNC() repeats such a measurement to get
+ * @ref CONFIG_BENCHMARK_SAMPLES samples after @ref CONFIG_BENCHMARK_WARMUP
+ * discarded ones, and prints the minimum, median, 99th percentile, mean and
+ * standard deviation of the runtime per call. Where available, the samples
+ * are taken with a cycle counter (the DWT on Cortex-M, the time stamp
+ * counter or `clock_gettime()` on native), otherwise with
+ * @ref ZTIMER_USEC, see @ref benchmark_clock_unit(). Besides a line for
+ * humans, each result is printed as a line of JSON, e.g.
+ *
+ *     {"benchmark": "mutex lock/unlock", "unit": "cycles", "runs": 1000, "samples": 64, "min": 61.000, "median": 61.000, "p99": 64.123, "mean": 61.210, "stddev": 0.511}
+ *
+ * `dist/tools/benchmark/benchmark_compare.py` collects these lines from the
+ * output of an application, stores them as baseline and compares later runs
+ * against it.
+ *
  * @{
  *
  * @file
@@ -30,6 +49,29 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup    sys_benchmark_conf  Benchmark compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of samples taken by @ref BENCHMARK_STATS_FUNC()
+ *
+ * The samples are kept on the stack of the calling thread.
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES
+#define CONFIG_BENCHMARK_SAMPLES    (64U)
+#endif
+
+/**
+ * @brief   Number of samples discarded by @ref BENCHMARK_STATS_FUNC() before
+ *          the first one is recorded
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP
+#define CONFIG_BENCHMARK_WARMUP     (4U)
+#endif
+/** @} */
+
 /**
  * @brief   Measure the runtime of a given function call
  *
@@ -37,6 +79,9 @@ extern "C" {
  * using a preprocessor function, as going with a function pointer or similar
  * would influence the measured runtime...
  *
+ * @note    @p func may use the loop counter `i` (e.g. as array index). It
+ *          shadows a variable `i` of the caller.
+ *
  * @param[in] name      name for labeling the output
  * @param[in] runs      number of times to run @p func
  * @param[in] func      function call to benchmark
@@ -61,6 +106,99 @@ extern "C" {
  */
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name);
 
+/**
+ * @brief   Measure the runtime of a given function call repeatedly and print
+ *          statistics of the runtime per call
+ *
+ * A sample is the runtime of @p runs calls of @p func. With the overhead of
+ * reading the clock being included once per sample, @p runs should be large
+ * enough for a sample to take a few hundred clock units.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] runs      number of times to run @p func per sample
+ * @param[in] func      function call to benchmark
+ */
+#define BENCHMARK_STATS_FUNC(name, runs, func)                          \
+    do {                                                                \
+        uint32_t _samples[CONFIG_BENCHMARK_SAMPLES];                    \
+        benchmark_clock_init();                                         \
+        for (unsigned _s = 0;                                           \
+             _s < CONFIG_BENCHMARK_WARMUP + CONFIG_BENCHMARK_SAMPLES;   \
+             _s++) {                                                    \
+            uint32_t _start = benchmark_clock_now();                    \
+            for (unsigned long _benchmark_i = 0; _benchmark_i < runs;   \
+                 _benchmark_i++) {                                      \
+                func;                                                   \
+            }                                                           \
+            uint32_t _time = benchmark_clock_now() - _start;            \
+            if (_s >= CONFIG_BENCHMARK_WARMUP) {                        \
+                _samples[_s - CONFIG_BENCHMARK_WARMUP] = _time;         \
+            }                                                           \
+        }                                                               \
+        benchmark_print_stats(name, runs, _samples,                     \
+                              CONFIG_BENCHMARK_SAMPLES);                \
+    } while (0)
+
+/**
+ * @brief   Statistics of the runtime per call of a benchmark
+ *
+ * All values are in 1/1000 of the unit given by @ref benchmark_clock_unit().
+ */
+typedef struct {
+    uint64_t min;       /**< minimum */
+    uint64_t median;    /**< median */
+    uint64_t p99;       /**< 99th percentile */
+    uint64_t mean;      /**< arithmetic mean */
+    uint64_t stddev;    /**< standard deviation */
+} benchmark_stats_t;
+
+/**
+ * @brief   Prepares the clock used by @ref BENCHMARK_STATS_FUNC()
+ *
+ * Enables the cycle counter, if it is not running yet. If @ref ZTIMER_USEC
+ * is used instead, it is acquired to keep it running. Calling it again is
+ * cheap.
+ */
+void benchmark_clock_init(void);
+
+/**
+ * @brief   Reads the clock used by @ref BENCHMARK_STATS_FUNC()
+ *
+ * @return  Current time in the unit given by @ref benchmark_clock_unit(),
+ *          wrapping around at UINT32_MAX
+ */
+uint32_t benchmark_clock_now(void);
+
+/**
+ * @brief   Gets the unit of @ref benchmark_clock_now()
+ *
+ * @return  "cycles", "ns" or "us"
+ */
+const char *benchmark_clock_unit(void);
+
+/**
+ * @brief   Calculates the statistics of the runtime per call from samples
+ *
+ * @param[out] stats    the statistics
+ * @param[in] runs      number of calls per sample
+ * @param[in,out] samples   runtime of @p runs calls each, gets sorted
+ * @param[in] numof     number of samples, must be > 0
+ */
+void benchmark_calc_stats(benchmark_stats_t *stats, unsigned long runs,
+                          uint32_t *samples, unsigned numof);
+
+/**
+ * @brief   Output the statistics of samples on STDIO, both as text and as
+ *          JSON
+ *
+ * @param[in] name      name to label the output
+ * @param[in] runs      number of calls per sample
+ * @param[in,out] samples   runtime of @p runs calls each, gets sorted
+ * @param[in] numof     number of samples, must be > 0
+ */
+void benchmark_print_stats(const char *name, unsigned long runs,
+                           uint32_t *samples, unsigned numof);
+
 #ifdef __cplusplus
 }
 #endif
@@ -86,6 +86,20 @@
  *
  * `GNRC_NETAPI_MSG_TYPE_GET` is not supported.
  *
+ * # Receive fast path
+ *
+ * Usually, a received UDP datagram is passed from the network interface
+ * thread to the IPv6 thread, from there to the UDP thread and finally to the
+ * socket, costing three messages and thread switches. With the pseudomodule
+ * `gnrc_rx_fastpath`, the thread that hands a packet to IPv6 (the network
+ * interface or the 6LoWPAN thread) instead calls
+ * @ref gnrc_ipv6_receive_fastpath(), which carries plain UDP datagrams to a
+ * unicast address of this host through IPv6 and UDP handling up to the
+ * receivers registered for the destination port in one call chain. Anything
+ * else (extension headers, multicast, forwarding, ICMPv6, malformed packets,
+ * or additional @ref net_gnrc_netreg subscribers in between) still takes the
+ * threaded path.
+ *
  * @{
  *
  * @file
@@ -229,6 +243,25 @@ kernel_pid_t gnrc_ipv6_init(void);
  */
 ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Handle a received IPv6 packet in the calling thread if possible
+ *
+ * If @p pkt is a UDP datagram without extension headers to a unicast address
+ * of this host, and the IPv6 and UDP threads are its only receivers on the
+ * way, it is processed and delivered to the UDP receivers right away.
+ * Otherwise @p pkt is not touched, and the caller has to dispatch it to the
+ * IPv6 thread as usual.
+ *
+ * @note    Only available with module `gnrc_rx_fastpath`.
+ *
+ * @param[in] pkt   A received packet in receive order, starting with a snip of
+ *                  type @ref GNRC_NETTYPE_IPV6.
+ *
+ * @return  true, if @p pkt was consumed
+ * @return  false, if @p pkt needs to take the threaded path
+ */
+bool gnrc_ipv6_receive_fastpath(gnrc_pktsnip_t *pkt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -250,6 +250,21 @@ extern "C" {
 #ifndef CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD
 #define CONFIG_GNRC_IPV6_NIB_MULTIHOP_DAD             0
 #endif
+
+/**
+ * @brief   Index off-link entries in a longest-prefix match trie
+ *
+ * Makes route lookups scale with the prefix length instead of
+ * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF, at the cost of
+ * `2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF` trie nodes of 12 bytes each on 32-bit platforms.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#if CONFIG_GNRC_IPV6_NIB_ROUTER
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                1
+#else
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE                0
+#endif
+#endif
 /** @} */
 
 /**
@@ -297,6 +312,23 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Number of hash buckets to index the on-link entries of the NIB
+ *          (neighbor cache) by their address
+ *
+ * Makes neighbor lookups O(1) on average instead of a linear search over all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries, at the cost of 2 bytes per bucket
+ * and 2 bytes per entry. 0 disables the index. By default, the index is only
+ * used for 16 entries or more.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+#if CONFIG_GNRC_IPV6_NIB_NUMOF >= 16
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS        (CONFIG_GNRC_IPV6_NIB_NUMOF / 2)
+#else
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS        (0)
+#endif
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -19,6 +19,17 @@
  * If you only have one network interface on the board, you can select the
  * `gnrc_netif_single` pseudo-module to enable further optimisations.
  *
+ * ## Burst transmission
+ *
+ * With the `gnrc_netif_tx_burst` pseudo-module, an interface that receives a
+ * send request also takes the send requests already waiting in its message
+ * queue (up to @ref CONFIG_GNRC_NETIF_TX_BURST_MAX) and passes all of them to
+ * gnrc_netif_ops_t::send_burst at once. This lets devices implementing
+ * @ref netdev_driver_t::send_burst transmit them back to back, e.g. on an
+ * Ethernet uplink of a border router that forwards traffic faster than
+ * the interface thread is scheduled. Other messages keep their order relative
+ * to the send requests.
+ *
  * @{
  *
  * @file
@@ -62,6 +73,9 @@
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq/type.h"
 #endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+#include "net/gnrc/netif/rx_poll/type.h"
+#endif
 #include "net/l2util.h"
 #include "net/ndp.h"
 #include "net/netdev.h"
@@ -216,6 +230,14 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL) || defined(DOXYGEN)
+    /**
+     * @brief   State of the adaptive polled reception
+     *
+     * @note    Only available with @ref net_gnrc_netif_rx_poll.
+     */
+    gnrc_netif_rx_poll_t rx_poll;
 #endif
     /**
      * @brief   Message queue for the netif thread
@@ -386,6 +408,30 @@ struct gnrc_netif_ops {
      * @param[in] msg   Message to be handled.
      */
     void (*msg_handler)(gnrc_netif_t *netif, msg_t *msg);
+
+    /**
+     * @brief   Send multiple @ref net_gnrc_pkt "packets" back to back over
+     *          the network interface
+     *
+     * @pre `netif != NULL && pkts != NULL && res != NULL && numof > 0`
+     *
+     * Used with the `gnrc_netif_tx_burst` module for devices using the
+     * legacy netdev API. Leave NULL if not supported, the packets are then
+     * passed to gnrc_netif_ops_t::send one after another.
+     *
+     * @note Like gnrc_netif_ops_t::send, the function releases all packets
+     *       before returning.
+     *
+     * @param[in] netif The network interface.
+     * @param[in] pkts  The packets to send, at most
+     *                  @ref CONFIG_GNRC_NETIF_TX_BURST_MAX.
+     * @param[out] res  The result of each packet, as gnrc_netif_ops_t::send
+     *                  would return it. Packets the device had no room for
+     *                  anymore get -EBUSY.
+     * @param[in] numof Number of packets in @p pkts.
+     */
+    void (*send_burst)(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[], int res[],
+                       unsigned numof);
 };
 
 /**
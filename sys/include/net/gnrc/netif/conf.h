@@ -79,6 +79,38 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Length of the rate window and interval between poll rounds in
+ *              microseconds for adaptive polled reception
+ *
+ * @see         net_gnrc_netif_rx_poll
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US
+#define CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US (1000U)
+#endif
+
+/**
+ * @brief       Default number of frames received within
+ *              @ref CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US to switch to polled
+ *              reception
+ *
+ * Set to 0 to never switch to polled reception by default.
+ *
+ * @see         net_gnrc_netif_rx_poll
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_POLL_THRESHOLD
+#define CONFIG_GNRC_NETIF_RX_POLL_THRESHOLD   (8U)
+#endif
+
+/**
+ * @brief       Default maximum number of frames taken per poll round
+ *
+ * @see         net_gnrc_netif_rx_poll
+ */
+#ifndef CONFIG_GNRC_NETIF_RX_POLL_BUDGET
+#define CONFIG_GNRC_NETIF_RX_POLL_BUDGET      (16U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -173,6 +205,17 @@ extern "C" {
 #ifndef CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US
 #define CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US   (0U)
 #endif
+
+/**
+ * @brief   Maximum number of packets sent in one burst
+ *
+ * With the `gnrc_netif_tx_burst` module, a network interface collects up to
+ * this many send requests already waiting in its message queue and passes
+ * them to the device at once.
+ */
+#ifndef CONFIG_GNRC_NETIF_TX_BURST_MAX
+#define CONFIG_GNRC_NETIF_TX_BURST_MAX  (4U)
+#endif
 /** @} */
 
 /**
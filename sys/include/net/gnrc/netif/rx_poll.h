@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_netif_rx_poll  Adaptive polled reception for @ref net_gnrc_netif
+ * @ingroup     net_gnrc_netif
+ * @brief       Switches a network interface from interrupt driven to polled
+ *              reception under load
+ *
+ * Normally, every received frame raises an interrupt that wakes the
+ * interface thread. Under high load, e.g. on the Ethernet uplink of a border
+ * router, these interrupts alone can starve lower priority threads.
+ *
+ * With the `gnrc_netif_rx_poll` module, an interface counts the frames
+ * received within @ref CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US. Once they
+ * reach the threshold of the interface, it disables the RX interrupt of the
+ * device (see @ref NETOPT_RX_END_IRQ) and polls the device every
+ * @ref CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US instead, taking at most the
+ * budget of the interface of frames per poll round. While polled, a device
+ * signals at most one frame per call of @ref netdev_driver_t::isr, so the
+ * budget holds regardless of how many frames the device has buffered. The
+ * thread sleeps between the rounds, which bounds the share of CPU time spent
+ * on reception. When a poll round finds no frame, the interface enables the RX
+ * interrupt again.
+ *
+ * Threshold and budget default to @ref CONFIG_GNRC_NETIF_RX_POLL_THRESHOLD
+ * and @ref CONFIG_GNRC_NETIF_RX_POLL_BUDGET and can be set per interface with
+ * @ref gnrc_netif_rx_poll_set(). Interfaces whose device does not support
+ * @ref NETOPT_RX_END_IRQ stay in interrupt mode. The number of mode switches
+ * is counted in gnrc_netif_rx_poll_t::to_poll and
+ * gnrc_netif_rx_poll_t::to_irq and shown by `ifconfig`.
+ *
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_rx_poll definitions
+ */
+#ifndef NET_GNRC_NETIF_RX_POLL_H
+#define NET_GNRC_NETIF_RX_POLL_H
+
+#include <stdint.h>
+
+#include "modules.h"
+#include "net/gnrc/netif.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL) || defined(DOXYGEN)
+/**
+ * @brief   Initializes polled reception of a network interface
+ *
+ * @note    Called by the thread of @p netif after the device was initialized.
+ *
+ * @param[in] netif The network interface.
+ */
+void gnrc_netif_rx_poll_init(gnrc_netif_t *netif);
+
+/**
+ * @brief   Configures polled reception of a network interface
+ *
+ * @param[in] netif     The network interface.
+ * @param[in] threshold Frames per @ref CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US
+ *                      to switch to polled mode. 0 to never poll.
+ * @param[in] budget    Maximum number of frames per poll round. Must not
+ *                      be 0.
+ */
+void gnrc_netif_rx_poll_set(gnrc_netif_t *netif, uint16_t threshold,
+                            uint16_t budget);
+
+/**
+ * @brief   Accounts a received frame
+ *
+ * @note    Called by the thread of @p netif for every
+ *          @ref NETDEV_EVENT_RX_COMPLETE.
+ *
+ * @param[in] netif The network interface.
+ */
+void gnrc_netif_rx_poll_rx(gnrc_netif_t *netif);
+
+/**
+ * @brief   Switches to polled mode if the receive rate exceeds the threshold
+ *
+ * @note    Called by the thread of @p netif after handling an interrupt of
+ *          the device.
+ *
+ * @param[in] netif The network interface.
+ */
+void gnrc_netif_rx_poll_isr_done(gnrc_netif_t *netif);
+#else
+static inline void gnrc_netif_rx_poll_init(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+
+static inline void gnrc_netif_rx_poll_rx(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+
+static inline void gnrc_netif_rx_poll_isr_done(gnrc_netif_t *netif)
+{
+    (void)netif;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_RX_POLL_H */
+/** @} */
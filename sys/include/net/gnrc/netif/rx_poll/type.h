@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  net_gnrc_netif_rx_poll
+ * @{
+ *
+ * @file
+ * @brief   @ref net_gnrc_netif_rx_poll type definitions
+ *
+ * Contained in its own file, so the type can be included in
+ * @ref gnrc_netif_t while the functions in net/gnrc/netif/rx_poll.h can use
+ * @ref gnrc_netif_t as operating type.
+ */
+#ifndef NET_GNRC_NETIF_RX_POLL_TYPE_H
+#define NET_GNRC_NETIF_RX_POLL_TYPE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   State of the adaptive polled reception of a network interface
+ */
+typedef struct {
+    event_t event;          /**< event running a poll round */
+    ztimer_t timer;         /**< timer posting gnrc_netif_rx_poll_t::event */
+    uint32_t window_start;  /**< start of the current rate window in µs */
+    uint32_t to_poll;       /**< number of switches to polled mode */
+    uint32_t to_irq;        /**< number of switches back to interrupt mode */
+    uint16_t rx;            /**< frames received in the current rate window
+                             *   or poll round */
+    uint16_t threshold;     /**< frames per rate window to switch to polled
+                             *   mode, 0 to never poll */
+    uint16_t budget;        /**< maximum number of frames per poll round */
+    bool polling;           /**< true while in polled mode */
+} gnrc_netif_rx_poll_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_NETIF_RX_POLL_TYPE_H */
+/** @} */
@@ -72,6 +72,25 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf  GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t (as exponent of 2^n)
+ *
+ * By default, all entries of a type are kept in one list, so every lookup
+ * scans all entries of that type, e.g. all registered UDP ports. With a value
+ * of `n > 0`, the entries are spread over 2^n lists by a hash of
+ * gnrc_netreg_entry_t::demux_ctx, at the cost of
+ * `(2^n - 1) * GNRC_NETTYPE_NUMOF` additional pointers.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP     (0U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -357,6 +376,8 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry);
  *
  * @param[in] type      Type of the protocol.
  * @param[in] entry     An entry you want to remove from the registry.
+ *                      gnrc_netreg_entry_t::demux_ctx must not have changed
+ *                      since @p entry was registered.
  */
 void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry);
 
@@ -121,6 +121,21 @@ typedef struct gnrc_pktsnip {
     kernel_pid_t err_sub;           /**< subscriber to errors related to this
                                      *   packet snip */
 #endif
+#if defined(MODULE_GNRC_PKTLAT) || defined(DOXYGEN)
+    /**
+     * @brief   Time the snip was stamped for @ref gnrc_pktsnip_t::lat_layer
+     *
+     * @internal
+     */
+    uint32_t lat_time;
+    /**
+     * @brief   Layer the snip was last stamped for by @ref net_gnrc_pktlat,
+     *          0 if not stamped
+     *
+     * @internal
+     */
+    uint8_t lat_layer;
+#endif
 } gnrc_pktsnip_t;
 
 /**
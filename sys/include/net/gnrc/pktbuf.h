@@ -12,6 +12,17 @@
  * @ingroup     net_gnrc
  * @brief       A global network packet buffer.
  *
+ * There are three implementations, selected by module:
+ *
+ * - `gnrc_pktbuf_static` (default): a first-fit allocator over an arena of
+ *   @ref CONFIG_GNRC_PKTBUF_SIZE bytes
+ * - `gnrc_pktbuf_malloc`: uses `malloc()`
+ * - `gnrc_pktbuf_slab`: segregated size classes of fixed-size objects for
+ *   packet snip descriptors, small headers, and MTU-sized payloads. Allocation
+ *   and release are O(1) and the buffer does not fragment. Data that does not
+ *   fit into its size class is put into the next larger class with free
+ *   objects. See @ref CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF and following.
+ *
  * @note    **WARNING!!** Do not store data structures that are not packed
  *          (defined with `__attribute__((packed))`) or enforce alignment in
  *          in any way in here if @ref CONFIG_GNRC_PKTBUF_SIZE > 0. On some RISC architectures
@@ -63,6 +74,53 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptors with `gnrc_pktbuf_slab`
+ *
+ * The objects of this size class are also used for data that fits into a
+ * @ref gnrc_pktsnip_t, e.g. UDP headers.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF     (32)
+#endif
+
+/**
+ * @brief   Object size of the small size class with `gnrc_pktbuf_slab`
+ *
+ * Used for headers and small payloads. The default fits a whole IEEE 802.15.4
+ * frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE     (128)
+#endif
+
+/**
+ * @brief   Number of objects in the small size class with `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF    (16)
+#endif
+
+/**
+ * @brief   Object size of the large size class with `gnrc_pktbuf_slab`
+ *
+ * This is the largest data section the packet buffer can hold. The default
+ * fits a whole Ethernet frame including its header and FCS (1518 bytes), as
+ * Ethernet interfaces receive a frame into a single data section. Frames that
+ * do not fit are dropped. Can be lowered to 1280 (the IPv6 minimum MTU) if
+ * only links with a smaller MTU, e.g. IEEE 802.15.4, are used.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE     (1536)
+#endif
+
+/**
+ * @brief   Number of objects in the large size class with `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF    (3)
+#endif
 /** @} */
 
 /**
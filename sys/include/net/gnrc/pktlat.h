@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktlat Per-layer packet latency
+ * @ingroup     net_gnrc
+ * @brief       Histograms of the time packets spend in each layer of GNRC
+ *
+ * With the `gnrc_pktlat` module, a packet is stamped with the current time
+ * and the layer it enters at the following points:
+ *
+ * | Layer                            | Entered at                          |
+ * |----------------------------------|-------------------------------------|
+ * | @ref GNRC_PKTLAT_NETIF_RX        | reception by the `gnrc_netif` thread|
+ * | @ref GNRC_PKTLAT_IPV6_RX         | reception by the IPv6 thread        |
+ * | @ref GNRC_PKTLAT_TRANSPORT_RX    | reception by the UDP thread         |
+ * | @ref GNRC_PKTLAT_SOCK_TX         | `gnrc_sock` send call               |
+ * | @ref GNRC_PKTLAT_TRANSPORT_TX    | send request to the UDP/TCP thread  |
+ * | @ref GNRC_PKTLAT_IPV6_TX         | send request to the IPv6 thread     |
+ * | @ref GNRC_PKTLAT_NETIF_TX        | send request to the `gnrc_netif`    |
+ *
+ * When a stamped packet reaches the next point, the time since the previous
+ * stamp is added to the histogram of the previous layer. This dwell time
+ * includes the time the packet waited in the message queue of the next
+ * layer. A layer ends without entering another one when a `gnrc_sock` user
+ * receives the packet, when the IPv6 thread hands it to TCP and when the
+ * `gnrc_netif` hands it to the network device driver. Time spent in an
+ * adaptation layer (e.g. 6LoWPAN) is accounted to the adjacent `gnrc_netif`
+ * layer.
+ *
+ * On reception, the stamp is kept in the first snip of the packet, on
+ * transmission in the snip holding the payload, which both persist while
+ * headers are marked or prepended. Packets created by layers in between
+ * (e.g. ICMPv6 or NDP messages) are only accounted from the first layer they
+ * reach.
+ *
+ * The histograms can be read with @ref gnrc_pktlat_get(), the `pktlat` shell
+ * command and @ref NETOPT_STATS with the @ref NETSTATS_PKTLAT context on any
+ * `gnrc_netif`.
+ *
+ * Overhead
+ * --------
+ *
+ * Without the module, nothing is compiled in and @ref gnrc_pktsnip_t keeps
+ * its size. With it,
+ *
+ * - every @ref gnrc_pktsnip_t grows by up to 8 bytes (a time stamp and the
+ *   layer, padded),
+ * - the histograms take `(GNRC_PKTLAT_NUMOF - 1) *
+ *   (16 + 4 * CONFIG_GNRC_PKTLAT_HIST_BUCKETS)` bytes of RAM (560 bytes with
+ *   the default configuration),
+ * - every stamp costs one `ztimer_now(ZTIMER_USEC)` (usually a read of the
+ *   timer peripheral), a count leading zeros and a handful of additions with
+ *   interrupts disabled. A UDP packet is stamped four times per direction,
+ *   which is small compared to a single message passing between the layers.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Per-layer packet latency definitions
+ */
+#ifndef NET_GNRC_PKTLAT_H
+#define NET_GNRC_PKTLAT_H
+
+#include <stdint.h>
+
+#include "modules.h"
+#include "net/gnrc/pkt.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_pktlat_conf    GNRC packet latency compile configurations
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of buckets of each histogram
+ *
+ * Bucket 0 counts dwell times of 0 µs, bucket `i` those from 2^(i - 1) µs to
+ * 2^i - 1 µs. The last bucket also counts all larger dwell times.
+ */
+#ifndef CONFIG_GNRC_PKTLAT_HIST_BUCKETS
+#define CONFIG_GNRC_PKTLAT_HIST_BUCKETS     (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Layers packets are timed in
+ */
+typedef enum {
+    GNRC_PKTLAT_NONE = 0,           /**< packet is not stamped */
+    GNRC_PKTLAT_NETIF_RX,           /**< received by the network interface */
+    GNRC_PKTLAT_IPV6_RX,            /**< received by IPv6 */
+    GNRC_PKTLAT_TRANSPORT_RX,       /**< received by UDP */
+    GNRC_PKTLAT_SOCK_TX,            /**< sent by a `gnrc_sock` user */
+    GNRC_PKTLAT_TRANSPORT_TX,       /**< sent by UDP or TCP */
+    GNRC_PKTLAT_IPV6_TX,            /**< sent by IPv6 */
+    GNRC_PKTLAT_NETIF_TX,           /**< sent by the network interface */
+    GNRC_PKTLAT_NUMOF,              /**< number of layers (plus one) */
+} gnrc_pktlat_layer_t;
+
+/**
+ * @brief   Histogram of the dwell times in a layer
+ */
+typedef struct {
+    uint64_t sum;       /**< sum of all dwell times in µs */
+    uint32_t count;     /**< number of packets */
+    uint32_t max;       /**< maximum dwell time in µs */
+    uint32_t hist[CONFIG_GNRC_PKTLAT_HIST_BUCKETS]; /**< histogram, see
+                                                     *   @ref CONFIG_GNRC_PKTLAT_HIST_BUCKETS */
+} gnrc_pktlat_hist_t;
+
+/**
+ * @brief   Histograms of all layers as returned for @ref NETOPT_STATS
+ */
+typedef struct {
+    /**
+     * @brief   Histograms, indexed by @ref gnrc_pktlat_layer_t - 1
+     */
+    gnrc_pktlat_hist_t layer[GNRC_PKTLAT_NUMOF - 1];
+} gnrc_pktlat_stats_t;
+
+#if IS_USED(MODULE_GNRC_PKTLAT) || defined(DOXYGEN)
+/**
+ * @brief   Initializes packet latency accounting
+ *
+ * Acquires `ZTIMER_USEC` for the packets to be stamped with. Called by
+ * auto_init.
+ */
+void gnrc_pktlat_init(void);
+
+/**
+ * @brief   Stamps a packet entering a layer
+ *
+ * If the packet was stamped before, its dwell time in the previous layer is
+ * accounted.
+ *
+ * @param[in] pkt   the packet, may be NULL
+ * @param[in] layer the layer the packet enters
+ */
+void gnrc_pktlat_stamp(gnrc_pktsnip_t *pkt, gnrc_pktlat_layer_t layer);
+
+/**
+ * @brief   Accounts the dwell time of a packet in the layer it was last
+ *          stamped for and removes the stamp
+ *
+ * @param[in] pkt   the packet, may be NULL
+ * @param[in] layer a layer of the same direction as the one the packet was
+ *                  stamped for
+ */
+void gnrc_pktlat_done(gnrc_pktsnip_t *pkt, gnrc_pktlat_layer_t layer);
+
+/**
+ * @brief   Gets the histogram of a layer
+ *
+ * @param[in] layer the layer
+ * @param[out] hist the histogram
+ */
+void gnrc_pktlat_get(gnrc_pktlat_layer_t layer, gnrc_pktlat_hist_t *hist);
+
+/**
+ * @brief   Gets the histograms of all layers
+ *
+ * @param[out] stats    the histograms
+ */
+void gnrc_pktlat_get_all(gnrc_pktlat_stats_t *stats);
+
+/**
+ * @brief   Resets all histograms
+ */
+void gnrc_pktlat_reset(void);
+
+/**
+ * @brief   Gets a human readable name of a layer
+ *
+ * @param[in] layer the layer
+ *
+ * @return  the name of @p layer
+ */
+const char *gnrc_pktlat_layer_str(gnrc_pktlat_layer_t layer);
+#else
+static inline void gnrc_pktlat_stamp(gnrc_pktsnip_t *pkt,
+                                     gnrc_pktlat_layer_t layer)
+{
+    (void)pkt;
+    (void)layer;
+}
+
+static inline void gnrc_pktlat_done(gnrc_pktsnip_t *pkt,
+                                    gnrc_pktlat_layer_t layer)
+{
+    (void)pkt;
+    (void)layer;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PKTLAT_H */
+/** @} */
@@ -73,6 +73,10 @@ extern "C" {
 /**
  * @brief   Size of the reassembly buffer
  *
+ * Fragments are matched to their entry through a hash index, so a large
+ * reassembly buffer (e.g. on a border router with many children) does not
+ * slow down the handling of subsequent fragments. Must be less than 255.
+ *
  * @note    Only applicable with
  *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
  */
@@ -121,6 +125,18 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER              (0U)
 #endif
 
+/**
+ * @brief   Number of flows the IPHC encoder caches the address compression for
+ *
+ * Every entry takes about 90 bytes of RAM.
+ *
+ * @note    Only applicable with the
+ *          [gnrc_sixlowpan_iphc_cache](@ref net_gnrc_sixlowpan_iphc) module.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE      (4U)
+#endif
+
 /**
  * @brief   Registration lifetime in minutes for the address registration option
  *
@@ -148,6 +164,10 @@ extern "C" {
  *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module,
  *          but has also a direct influence on the number of available
  *          gnrc_sixlowpan_frag_rb_int_t entries.
+ *
+ * Entries are looked up by link-layer source address and tag in a hash
+ * table, so forwarding a fragment does not depend on this size. At most 254
+ * entries are supported.
  */
 #ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
@@ -275,12 +275,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
  *
  * @param[in] rbuf  A reassembly buffer entry. Must not be NULL.
  */
-static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    assert(rbuf != NULL);
-    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
-    rbuf->pkt = NULL;
-}
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf);
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
  * compiled in */
@@ -144,15 +144,11 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
 /**
  * @brief   Removes an entry from the VRB
  *
+ * Removing an entry that is already empty has no effect.
+ *
  * @param[in] vrb   A VRB entry
  */
-static inline void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
-{
-    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
-        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
-    }
-    vrb->super.src_len = 0;
-}
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb);
 
 /**
  * @brief   Determines if a VRB entry is empty
@@ -10,6 +10,22 @@
  * @defgroup    net_gnrc_sixlowpan_iphc   IPv6 header compression (IPHC)
  * @ingroup     net_gnrc_sixlowpan
  * @brief       IPv6 header compression for 6LoWPAN.
+ *
+ * Flow cache
+ * ==========
+ *
+ * Most of the work of compressing an IPv6 header goes into the addresses:
+ * looking up contexts for source and destination and deriving the interface
+ * identifiers from the link-layer addresses. With the
+ * `gnrc_sixlowpan_iphc_cache` module, the result of this is kept for the last
+ * @ref CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE flows, identified by interface,
+ * source and destination address and link-layer destination. Subsequent
+ * packets of a flow only need the traffic class, flow label, next header and
+ * hop limit to be compressed, which are cheap to check.
+ *
+ * The cache is invalidated with @ref gnrc_sixlowpan_iphc_cache_invalidate()
+ * whenever a context or the link-layer address of an interface changes.
+ * Contexts whose lifetime expired are detected on use.
  * @{
  *
  * @file
@@ -22,6 +38,7 @@
 
 #include <stdbool.h>
 
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "net/sixlowpan.h"
 
@@ -63,6 +80,23 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
  */
 void gnrc_sixlowpan_iphc_send(gnrc_pktsnip_t *pkt, void *ctx, unsigned page);
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE) || defined(DOXYGEN)
+/**
+ * @brief   Invalidates all entries of the flow cache
+ *
+ * Needs to be called when information the compression of addresses depends
+ * on changes. This is done by @ref net_gnrc_sixlowpan_ctx and
+ * @ref net_gnrc_netif already. May be called from any thread.
+ *
+ * @note    Only available with the `gnrc_sixlowpan_iphc_cache` module.
+ */
+void gnrc_sixlowpan_iphc_cache_invalidate(void);
+#else
+static inline void gnrc_sixlowpan_iphc_cache_invalidate(void)
+{
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,6 +23,7 @@
 #define NET_GNRC_TCP_H
 
 #include <stdint.h>
+#include "iolist.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -157,6 +158,42 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue);
  */
 int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port);
 
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN) || defined(DOXYGEN)
+/**
+ * @brief Opens a connection using TCP Fast Open (RFC 7413).
+ *
+ * If a cookie of the remote endpoint was cached by an earlier connection,
+ * up to one MSS of @p data is sent along with the SYN. Otherwise the SYN
+ * requests a cookie for the next connection. Data the peer did not accept
+ * during connection setup has to be sent with gnrc_tcp_send() afterwards.
+ *
+ * A TCB listening via gnrc_tcp_listen_fastopen() accepts data of a SYN
+ * carrying a valid cookie, so the data can be received right after
+ * gnrc_tcp_accept() returned.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL
+ * @pre @p remote must not be NULL.
+ * @pre @p remote->port must not be 0.
+ * @pre @p data must not be NULL if @p len is not 0.
+ *
+ * @note Blocks until a connection was established or an error occurred.
+ *
+ * @param[in,out] tcb          TCB for this connection.
+ * @param[in]     remote       Remote endpoint to connect to.
+ * @param[in]     local_port   If zero or PORT_UNSPEC, the connections source port
+ *                             is randomly selected. If local_port is non-zero
+ *                             it is used as source port.
+ * @param[in]     data         Data to send along with the SYN.
+ * @param[in]     len          Number of bytes in @p data. 0 to only request a cookie.
+ *
+ * @return   Number of bytes of @p data acknowledged during connection setup.
+ * @return   Negative error codes of gnrc_tcp_open().
+ */
+ssize_t gnrc_tcp_open_fastopen(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
+                               uint16_t local_port, const void *data, size_t len);
+#endif
+
 /**
  * @brief Configures a sequence of TCBs to wait for incoming connections.
  *
@@ -176,12 +213,37 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
  * @return   -EAFNOSUPPORT given address family in @p local is not supported.
  * @return   -EINVAL address_family in @p tcbs and @p local do not match.
  * @return   -EISCONN a TCB in @p tcbs is already connected.
- * @return   -ENOMEM all available receive buffers are in use.
- *                   Increase GNRC_TCP_RCV_BUFFERS.
+ * @return   -ENOMEM the receive buffer pool is exhausted.
+ *                   Increase CONFIG_GNRC_TCP_RCVBUF_POOL_SIZE.
  */
 int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
                     const gnrc_tcp_ep_t *local);
 
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN) || defined(DOXYGEN)
+/**
+ * @brief Configures a sequence of TCBs to wait for incoming connections
+ *        using TCP Fast Open (RFC 7413).
+ *
+ * Works like gnrc_tcp_listen(), but the TCBs additionally hand out cookies
+ * to peers requesting one and accept the data of SYNs carrying a valid
+ * cookie. The data of such a SYN may be a replay of an earlier one (see
+ * RFC 7413, section 6.1), so only enable this for applications that can
+ * cope with duplicate requests.
+ *
+ * @pre Same as for gnrc_tcp_listen().
+ *
+ * @param[in,out] queue   Listening queue for incoming connections.
+ * @param[in] tcbs        TCBs associated with @p queue.
+ * @param[in] tcbs_len    Number of TCBs behind @p tcbs.
+ * @param[in] local       Endpoint specifying address and port to listen on.
+ *
+ * @returns   0 on success.
+ * @return    Negative error codes of gnrc_tcp_listen().
+ */
+int gnrc_tcp_listen_fastopen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs,
+                             size_t tcbs_len, const gnrc_tcp_ep_t *local);
+#endif
+
 /**
  * @brief Accept TCP connection from listening queue.
  *
@@ -214,6 +276,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       The function returns as soon as the data was queued for transmission, it does
+ *       not wait for its acknowledgement. At most CONFIG_GNRC_TCP_RTX_QUEUE_SIZE
+ *       segments are unacknowledged at any time.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -234,6 +299,51 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
 
+/**
+ * @brief Transmit data gathered from an iolist to connected peer.
+ *
+ * Behaves like gnrc_tcp_send(), but copies the data directly from the
+ * buffers of @p iolist into the segments.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[in]     iolist                     Data that should be transmitted.
+ * @param[in]     user_timeout_duration_ms   See gnrc_tcp_send().
+ *
+ * @return   The number of successfully transmitted bytes.
+ * @return   Negative error codes of gnrc_tcp_send().
+ */
+ssize_t gnrc_tcp_send_iolist(gnrc_tcp_tcb_t *tcb, const iolist_t *iolist,
+                             const uint32_t user_timeout_duration_ms);
+
+/**
+ * @brief Transmit data held in the packet buffer to connected peer without copying it.
+ *
+ * Behaves like gnrc_tcp_send(), but the segments reference the snips of
+ * @p pkt instead of copies. The transmitted leading part of @p pkt is taken
+ * over by TCP and released once it was acknowledged, retransmissions reuse
+ * it. A snip is split if a segment ends within it.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ * @pre @p pkt must not be NULL.
+ * @pre @p *pkt must not be used elsewhere, i.e. gnrc_pktsnip_t::users is 1.
+ *
+ * @param[in,out] tcb                        TCB holding the connection information.
+ * @param[in,out] pkt                        Payload snips that should be transmitted. Points
+ *                                           to the remainder that was not transmitted
+ *                                           afterwards, NULL if everything was transmitted.
+ *                                           The caller still owns the remainder.
+ * @param[in]     user_timeout_duration_ms   See gnrc_tcp_send().
+ *
+ * @return   The number of successfully transmitted bytes.
+ * @return   Negative error codes of gnrc_tcp_send().
+ */
+ssize_t gnrc_tcp_send_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **pkt,
+                          const uint32_t user_timeout_duration_ms);
+
 /**
  * @brief Receive Data from the peer.
  *
@@ -328,6 +438,23 @@ int gnrc_tcp_get_local(gnrc_tcp_tcb_t *tcb, gnrc_tcp_ep_t *ep);
  */
 int gnrc_tcp_get_remote(gnrc_tcp_tcb_t *tcb, gnrc_tcp_ep_t *ep);
 
+/**
+ * @brief Get the receive buffer statistics of a TCB
+ *
+ * The receive buffers of all connections share a pool. A receive buffer
+ * grows while the user reads data fast and shrinks while the user reads
+ * data slowly or not at all.
+ *
+ * @pre tcb must not be NULL
+ * @pre stats must not be NULL
+ *
+ * @param[in] tcb      TCB holding the connection information.
+ * @param[out] stats   The receive buffer statistics.
+ *                     Size and available data are zero if @p tcb holds no
+ *                     receive buffer.
+ */
+void gnrc_tcp_get_rcvbuf_stats(gnrc_tcp_tcb_t *tcb, gnrc_tcp_rcvbuf_stats_t *stats);
+
 /**
  * @brief Gets the local end point of a TCB queue
  *
@@ -92,20 +92,94 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers.
+ * @brief Number of default window sized receive buffers the receive buffer pool holds.
  *
  * This value determines how many parallel TCP connections can be active at the
- * same time.
+ * same time if no connection grew its receive buffer.
  */
 #ifndef CONFIG_GNRC_TCP_RCV_BUFFERS
 #define CONFIG_GNRC_TCP_RCV_BUFFERS (1U)
 #endif
 
 /**
- * @brief Default receive buffer size
+ * @brief Size of the receive buffer pool shared by all connections in bytes.
+ */
+#ifndef CONFIG_GNRC_TCP_RCVBUF_POOL_SIZE
+#define CONFIG_GNRC_TCP_RCVBUF_POOL_SIZE (CONFIG_GNRC_TCP_RCV_BUFFERS * \
+                                          CONFIG_GNRC_TCP_DEFAULT_WINDOW)
+#endif
+
+/**
+ * @brief Allocation granularity of the receive buffer pool in bytes.
+ */
+#ifndef CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE
+#define CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE (64U)
+#endif
+
+/**
+ * @brief Size an idle receive buffer shrinks to in bytes.
+ *
+ * A connection starts with a receive buffer of CONFIG_GNRC_TCP_DEFAULT_WINDOW
+ * bytes. The buffer grows if the user reads data faster than the window
+ * allows the peer to send it and shrinks down to this size if the user reads
+ * data slowly or not at all.
+ */
+#ifndef CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE
+#define CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE (CONFIG_GNRC_TCP_MSS)
+#endif
+
+/**
+ * @brief Maximum receive buffer size of a single connection
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
-#define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
+#define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_RCVBUF_POOL_SIZE)
+#endif
+
+/**
+ * @brief Maximum number of unacknowledged segments per connection.
+ *
+ * Every segment is kept in the packet buffer until it is acknowledged, so
+ * the packet buffer must be able to hold this many MSS sized segments for
+ * each connection. A value of 1 results in stop-and-wait behavior.
+ *
+ * @note The value must not exceed 31.
+ */
+#ifndef CONFIG_GNRC_TCP_RTX_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RTX_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Number of out-of-order blocks a receiver keeps track of.
+ *
+ * Those blocks are reported to the peer in the SACK option (RFC 2018), if the
+ * peer permitted selective acknowledgements. Each block takes 8 bytes in the
+ * TCB.
+ *
+ * @note The value must not exceed 4, as no more blocks fit into the TCP
+ *       option field.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_BLOCKS
+#define CONFIG_GNRC_TCP_SACK_BLOCKS (3U)
+#endif
+
+/**
+ * @brief Number of peers a client keeps a TCP Fast Open cookie for.
+ *
+ * Only used with the module `gnrc_tcp_fastopen`. Each entry takes about
+ * 40 bytes. If the cache is full, the least recently used cookie is dropped.
+ */
+#ifndef CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE
+#define CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE (4U)
+#endif
+
+/**
+ * @brief Length of the TCP Fast Open cookies a server hands out in bytes.
+ *
+ * Only used with the module `gnrc_tcp_fastopen`. RFC 7413 allows even
+ * values from 4 to 16.
+ */
+#ifndef CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN
+#define CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN (8U)
 #endif
 
 /**
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp_congure Congestion control for GNRC TCP
+ * @ingroup     net_gnrc_tcp
+ *
+ * @brief       Congestion control for GNRC TCP using the @ref sys_congure
+ *
+ * By default, GNRC TCP uses its built-in NewReno congestion control. With the
+ * module `gnrc_tcp_congure`, a @ref congure_snd_t object can be attached to a
+ * connection using @ref gnrc_tcp_tcb_set_congure(). The congestion window of
+ * that connection is then taken from the CongURE object, while GNRC TCP keeps
+ * detecting and retransmitting lost segments itself. A TCB without CongURE
+ * object keeps using the built-in congestion control.
+ *
+ * The following sub-modules provide state objects set up for GNRC TCP:
+ *
+ * - `gnrc_tcp_congure_reno`: @ref sys_congure_reno, see
+ *   @ref gnrc_tcp_congure_reno_setup()
+ * - `gnrc_tcp_congure_abe`: @ref sys_congure_abe, see
+ *   @ref gnrc_tcp_congure_abe_setup(). As GNRC TCP does not support explicit
+ *   congestion notification, it behaves like TCP Reno for now.
+ *
+ * Other implementations, e.g. delay-based ones, can be attached the same
+ * way. The window unit is @ref GNRC_TCP_CONGURE_UNIT.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static congure_reno_snd_t cong;
+ * ...
+ * gnrc_tcp_tcb_init(&tcb);
+ * gnrc_tcp_congure_reno_setup(&cong);
+ * gnrc_tcp_tcb_set_congure(&tcb, &cong.super);
+ * gnrc_tcp_open(&tcb, &remote, 0);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       CongURE definitions for @ref net_gnrc_tcp
+ */
+#ifndef NET_GNRC_TCP_CONGESTION_H
+#define NET_GNRC_TCP_CONGESTION_H
+
+#include "congure.h"
+#include "modules.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) || defined(DOXYGEN)
+#include "congure/reno.h"
+#endif
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE) || defined(DOXYGEN)
+#include "congure/abe.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   The window unit for CongURE with GNRC TCP is one byte
+ *
+ * Windows larger than @ref CONGURE_WND_SIZE_MAX are reported as
+ * @ref CONGURE_WND_SIZE_MAX.
+ */
+#define GNRC_TCP_CONGURE_UNIT   (1U)
+
+/**
+ * @brief   Attaches a CongURE state object to a TCB
+ *
+ * The object is initialized with @p tcb as context, whenever a connection of
+ * @p tcb is established. It must be set up with a driver and stay valid as
+ * long as @p tcb is in use. A state object must not be attached to more than
+ * one TCB.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb is not connected.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     congure   CongURE state object. NULL selects the built-in
+ *                          congestion control.
+ */
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *congure);
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) || defined(DOXYGEN)
+/**
+ * @brief   Sets up a @ref sys_congure_reno state object for GNRC TCP
+ *
+ * The initial window is calculated from the SMSS of the connection, i.e.
+ * @ref CONFIG_GNRC_TCP_MSS or the smaller MSS announced by the peer.
+ *
+ * @param[out] c    The state object.
+ */
+void gnrc_tcp_congure_reno_setup(congure_reno_snd_t *c);
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE) || defined(DOXYGEN)
+/**
+ * @brief   Sets up a @ref sys_congure_abe state object for GNRC TCP
+ *
+ * The initial window is calculated from the SMSS of the connection, i.e.
+ * @ref CONFIG_GNRC_TCP_MSS or the smaller MSS announced by the peer.
+ *
+ * @param[out] c    The state object.
+ */
+void gnrc_tcp_congure_abe_setup(congure_abe_snd_t *c);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_CONGESTION_H */
+/** @} */
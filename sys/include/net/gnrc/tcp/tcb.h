@@ -27,9 +27,14 @@
 #include "evtimer_mbox.h"
 #include "msg.h"
 #include "mbox.h"
+#include "modules.h"
 #include "net/gnrc/pkt.h"
 #include "config.h"
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "congure.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
@@ -38,6 +43,27 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Block of out-of-order data held in the receive buffer.
+ */
+typedef struct {
+    uint32_t left;  /**< First sequence number of the block */
+    uint32_t right; /**< Sequence number following the last byte of the block */
+} gnrc_tcp_sack_block_t;
+
+/**
+ * @brief Receive buffer statistics of a connection.
+ */
+typedef struct {
+    uint32_t size;        /**< Current size of the receive buffer in bytes */
+    uint32_t size_max;    /**< Largest size the receive buffer had in bytes */
+    uint32_t avail;       /**< Number of bytes waiting to be read */
+    uint32_t read;        /**< Number of bytes read by the user */
+    uint16_t grown;       /**< Number of times the receive buffer grew */
+    uint16_t shrunk;      /**< Number of times the receive buffer shrunk */
+    uint16_t grow_failed; /**< Number of times the pool had no space to grow the receive buffer */
+} gnrc_tcp_rcvbuf_stats_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -51,29 +77,57 @@ typedef struct sock_tcp {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wnd_scale; /**< Shift count of windows received from the peer */
+    uint8_t rcv_wnd_scale; /**< Shift count of windows sent to the peer */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Value of snd_nxt when loss recovery was entered */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< Sequence number ending the rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t rtx_len;       /**< Number of segments in the retransmit queue */
+    uint8_t rcv_sack_len;  /**< Number of blocks in rcv_sack */
+    uint32_t rtx_sacked;   /**< Bitmask of queued segments selectively acknowledged */
+    uint32_t rtx_lost;     /**< Bitmask of queued segments waiting for retransmission */
+    uint32_t rtx_resent;   /**< Bitmask of queued segments retransmitted during recovery */
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+    congure_snd_t *congure;   /**< CongURE state object, NULL for built-in congestion control */
+    uint16_t congure_flight;  /**< Number of bytes reported to congure as in flight */
+#endif
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    evtimer_msg_event_t event_rcvbuf;     /**< Receive buffer autotuning event */
+    /**
+     * @brief Retransmit queue, oldest segment first. One entry is kept for a FIN.
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RTX_QUEUE_SIZE + 1];
+    /**
+     * @brief Out-of-order data in rcv_buf, most recent block first.
+     */
+    gnrc_tcp_sack_block_t rcv_sack[CONFIG_GNRC_TCP_SACK_BLOCKS];
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+    uint32_t rcv_buf_time;   /**< Start of the current receive buffer autotuning interval */
+    uint32_t rcv_buf_read;   /**< Bytes read by the user in the current autotuning interval */
+    uint32_t rcv_buf_shrink; /**< Size to shrink the receive buffer to, 0 if none pending */
+    gnrc_tcp_rcvbuf_stats_t rcv_buf_stats; /**< Receive buffer statistics */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
@@ -99,6 +99,20 @@ int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr);
 gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
                                    uint16_t dst);
 
+/**
+ * @brief   Demultiplex a received UDP datagram to its receivers
+ *
+ * Validates the checksum and dispatches the payload to all receivers
+ * registered for (@ref GNRC_NETTYPE_UDP, destination port). This is what the
+ * UDP thread does on @ref GNRC_NETAPI_MSG_TYPE_RCV, and is called directly
+ * by the [receive fast path](@ref gnrc_ipv6_receive_fastpath()).
+ *
+ * @param[in] pkt   A received packet in receive order. The UDP header and
+ *                  its payload are in the first snip, the packet contains a
+ *                  snip of type @ref GNRC_NETTYPE_IPV6.
+ */
+void gnrc_udp_demux(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief   Initialize and start UDP
  *
@@ -827,6 +827,19 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_enable_t) Enable or disable the interrupt for
+     *          received frames
+     *
+     * While disabled, the device does not signal received frames by itself.
+     * Instead, the upper layer polls the device by calling
+     * @ref netdev_driver_t::isr, which signals
+     * @ref NETDEV_EVENT_RX_COMPLETE for at most one received frame per call
+     * and does nothing if no frame was received. This lets the upper layer
+     * limit the number of frames it handles per poll. Enabled by default.
+     */
+    NETOPT_RX_END_IRQ,
+
     /**
      * @brief   maximum number of options defined here.
      *
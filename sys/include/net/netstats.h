@@ -51,6 +51,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_PKTLAT     (0x04)  /**< @ref net_gnrc_pktlat histograms */
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
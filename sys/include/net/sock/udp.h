@@ -373,6 +373,34 @@ typedef struct {
     sock_aux_flags_t flags; /**< Flags used request information */
 } sock_udp_aux_tx_t;
 
+/**
+ * @brief   A datagram received with @ref sock_udp_recv_many or sent with
+ *          @ref sock_udp_send_many
+ */
+typedef struct {
+    /**
+     * @brief   Payload to send or space to store the received payload in
+     */
+    void *data;
+    /**
+     * @brief   Length of the payload to send or space available at
+     *          sock_udp_mmsg_t::data
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point the datagram is sent to or was received from
+     *
+     * May be `NULL`, if the datagram is sent to the remote end point of the
+     * sock or if the remote of a received datagram is not required by the
+     * application.
+     */
+    sock_udp_ep_t *remote;
+    /**
+     * @brief   Number of bytes received or sent
+     */
+    size_t msg_len;
+} sock_udp_mmsg_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -797,6 +825,83 @@ static inline ssize_t sock_udp_sendv(sock_udp_t *sock,
     return sock_udp_sendv_aux(sock, snips, remote, NULL);
 }
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * Waits up to @p timeout for the first datagram, like @ref sock_udp_recv.
+ * Datagrams that are already queued at @p sock at that point are received
+ * along with it without waiting for them. This saves the per call overhead
+ * of receiving them one by one.
+ *
+ * @pre `(sock != NULL) && (msgs != NULL) && (num > 0)`
+ * @pre sock_udp_mmsg_t::data of all @p msgs must not be `NULL` and
+ *      sock_udp_mmsg_t::len must be greater than 0
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[in,out] msgs  Space for the received datagrams. sock_udp_mmsg_t::msg_len
+ *                      and sock_udp_mmsg_t::remote of the received datagrams are set.
+ * @param[in] num       Number of datagrams @p msgs has space for.
+ * @param[in] timeout   Timeout for the first datagram in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ *
+ * @experimental    This function is quite new, not implemented for all stacks
+ *                  yet, and may be subject to sudden API changes. Do not use in
+ *                  production if this is unacceptable.
+ *
+ * @note    Datagrams other than the first one that do not fit into their
+ *          space in @p msgs or are not accepted by @p sock are dropped, like
+ *          @ref sock_udp_recv would drop them.
+ *
+ * @return  The number of datagrams received on success.
+ * @return  The negative error codes of @ref sock_udp_recv, if receiving the
+ *          first datagram fails.
+ */
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, size_t num,
+                           uint32_t timeout);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * @pre `(sock != NULL) || (sock_udp_mmsg_t::remote of all @p msgs != NULL)`
+ * @pre `(msgs != NULL) || (num == 0)`
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in,out] msgs  Datagrams to send, processed in order.
+ *                      sock_udp_mmsg_t::msg_len of the sent datagrams is set.
+ * @param[in] num       Number of datagrams in @p msgs.
+ *
+ * @experimental    This function is quite new and may be subject to sudden API
+ *                  changes. Do not use in production if this is unacceptable.
+ *
+ * @note    Sending stops at the first datagram that fails. The number of
+ *          datagrams sent before is returned, if there are any.
+ *
+ * @return  The number of datagrams sent on success.
+ * @return  The negative error codes of @ref sock_udp_send, if sending the
+ *          first datagram fails.
+ */
+static inline ssize_t sock_udp_send_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs,
+                                         size_t num)
+{
+    ssize_t res = 0;
+    size_t i;
+
+    assert((msgs != NULL) || (num == 0));
+    for (i = 0; i < num; i++) {
+        res = sock_udp_send(sock, msgs[i].data, msgs[i].len, msgs[i].remote);
+        if (res < 0) {
+            break;
+        }
+        msgs[i].msg_len = res;
+    }
+    return (i > 0) ? (ssize_t)i : res;
+}
+
 /**
  * @brief   Checks if the IP address of an endpoint is multicast
  *
@@ -16,6 +16,12 @@
  *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
+ *
+ * With the `schedstatistics_latency` pseudo-module, the wakeup latency of
+ * every thread is recorded as well: the time from the thread becoming
+ * runnable in @ref sched_set_status() (e.g. by receiving a message or
+ * unlocking a mutex it waits for) until @ref sched_run() switches to it. The
+ * worst case and a histogram of these latencies are shown by `ps`.
  * @{
  *
  * @file
@@ -29,12 +35,31 @@
 #ifndef SCHEDSTATISTICS_H
 #define SCHEDSTATISTICS_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "modules.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
 
+/**
+ * @defgroup    schedstatistics_conf    Schedstatistics compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the wakeup latency histogram of each thread
+ *
+ * Bucket 0 counts latencies of 0 µs, bucket `i` those from 2^(i - 1) µs to
+ * 2^i - 1 µs. The last bucket also counts all larger latencies.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS
+#define CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS  (12U)
+#endif
+/** @} */
+
 /**
  *  Scheduler statistics
  */
@@ -43,6 +68,18 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_us;     /**< The total runtime of this thread in microseconds */
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY) || defined(DOXYGEN)
+    uint32_t wakeup;         /**< Time stamp of the last time this thread
+                                  became runnable */
+    uint32_t latency_max;    /**< Worst case wakeup latency in microseconds */
+    /**
+     * @brief   Histogram of the wakeup latency, see
+     *          @ref CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS
+     */
+    uint32_t latency_hist[CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS];
+    bool waking;             /**< Thread is runnable, but was not scheduled
+                                  since */
+#endif
 } schedstat_t;
 
 /**
@@ -56,6 +93,17 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ *  @brief  The sched statistics callback
+ *
+ *  Modules registering their own callback with @ref sched_register_cb()
+ *  need to call it from there to keep the statistics running.
+ *
+ *  @param[in]  active_thread   Pid of the active thread
+ *  @param[in]  next_thread     Pid of the next scheduled thread
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_trace_event Structured execution tracing
+ * @ingroup     sys
+ * @brief       Record typed events into a ring buffer and view them as a
+ *              timeline
+ *
+ * Unlike @ref trace(), which stores a bare value, every event consists of
+ * an event ID, an argument, the context it was recorded in (thread or ISR)
+ * and whether it is an instant or marks the begin or end of a slice:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #include "trace_event.h"
+ *
+ * #define MY_EVENT_RX     (TRACE_EVENT_ID_USER + 0)
+ * ...
+ * trace_event_begin(MY_EVENT_RX, pkt_len);
+ * ...
+ * trace_event_end(MY_EVENT_RX, 0);
+ * ...
+ * trace_event_dump();
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The following pseudo-modules record events of the system itself:
+ *
+ * - `trace_event_sched`: a slice per thread while it is running, using the
+ *   scheduler callback (see @ref sched_register_cb()). If `schedstatistics`
+ *   is used as well, its callback is still called.
+ * - `trace_event_isr`: a slice per interrupt service routine, currently
+ *   recorded by the interrupt dispatcher of `native`. Other platforms may call
+ *   @ref trace_event_isr_enter() and @ref trace_event_isr_exit() from their
+ *   dispatch code.
+ * - `trace_event_msg`: an instant for every message sent and received with
+ *   the argument being the peer PID (upper 16 bit) and the message type.
+ *
+ * Recording an event claims a slot of the ring buffer with a single atomic
+ * increment and does not disable interrupts on platforms providing atomic
+ * read-modify-write operations. As RIOT schedules threads on a single core,
+ * there is a single ring. When the ring is full, the oldest events are
+ * overwritten.
+ *
+ * @ref trace_event_dump() prints the ring as text, on `native`
+ * @ref trace_event_dump_file() writes it into a binary file.
+ * `dist/tools/trace_event/trace_event_decode.py` converts both into the JSON
+ * trace event format read by chrome://tracing and https://ui.perfetto.dev.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Structured execution tracing API
+ */
+
+#ifndef TRACE_EVENT_H
+#define TRACE_EVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_trace_event_conf    Structured tracing compile configurations
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of events kept in the ring buffer
+ *
+ * Every event takes 12 bytes.
+ */
+#ifndef CONFIG_TRACE_EVENT_BUFSIZE
+#define CONFIG_TRACE_EVENT_BUFSIZE      (256U)
+#endif
+/** @} */
+
+/**
+ * @name    Event IDs recorded by RIOT itself
+ * @{
+ */
+#define TRACE_EVENT_ID_THREAD           (0x0001U)   /**< thread running,
+                                                     *   argument: PID */
+#define TRACE_EVENT_ID_ISR              (0x0002U)   /**< ISR running,
+                                                     *   argument: IRQ number */
+#define TRACE_EVENT_ID_MSG_SEND         (0x0003U)   /**< message sent */
+#define TRACE_EVENT_ID_MSG_RECV         (0x0004U)   /**< message received */
+/** @} */
+
+/**
+ * @brief   First event ID available to applications and modules
+ */
+#define TRACE_EVENT_ID_USER             (0x0100U)
+
+/**
+ * @brief   Context of events recorded in an ISR
+ */
+#define TRACE_EVENT_CTX_ISR             (0xffU)
+
+/**
+ * @brief   Kind of an event
+ */
+typedef enum {
+    TRACE_EVENT_INSTANT = 0,    /**< point in time */
+    TRACE_EVENT_BEGIN,          /**< begin of a slice */
+    TRACE_EVENT_END,            /**< end of the slice last begun with the
+                                 *   same ID in the same context */
+} trace_event_kind_t;
+
+/**
+ * @brief   A recorded event
+ *
+ * This is also the layout of the records written by
+ * @ref trace_event_dump_file(), in host byte order.
+ */
+typedef struct {
+    uint32_t time;      /**< time stamp in microseconds */
+    uint32_t arg;       /**< argument */
+    uint16_t id;        /**< event ID */
+    uint8_t ctx;        /**< PID of the thread or @ref TRACE_EVENT_CTX_ISR */
+    uint8_t kind;       /**< @ref trace_event_kind_t */
+} trace_event_t;
+
+/**
+ * @brief   Records an event
+ *
+ * Safe to call from threads and ISRs.
+ *
+ * @param[in] id    event ID
+ * @param[in] kind  kind of event
+ * @param[in] arg   argument
+ */
+void trace_event_record(uint16_t id, trace_event_kind_t kind, uint32_t arg);
+
+/**
+ * @brief   Records an instant event
+ *
+ * @param[in] id    event ID
+ * @param[in] arg   argument
+ */
+static inline void trace_event(uint16_t id, uint32_t arg)
+{
+    trace_event_record(id, TRACE_EVENT_INSTANT, arg);
+}
+
+/**
+ * @brief   Records the begin of a slice
+ *
+ * @param[in] id    event ID
+ * @param[in] arg   argument
+ */
+static inline void trace_event_begin(uint16_t id, uint32_t arg)
+{
+    trace_event_record(id, TRACE_EVENT_BEGIN, arg);
+}
+
+/**
+ * @brief   Records the end of a slice
+ *
+ * @param[in] id    event ID
+ * @param[in] arg   argument
+ */
+static inline void trace_event_end(uint16_t id, uint32_t arg)
+{
+    trace_event_record(id, TRACE_EVENT_END, arg);
+}
+
+/**
+ * @brief   Records the entry of an interrupt service routine
+ *
+ * Does nothing without the `trace_event_isr` module.
+ *
+ * @param[in] irq   number of the interrupt
+ */
+static inline void trace_event_isr_enter(unsigned irq)
+{
+    if (IS_USED(MODULE_TRACE_EVENT_ISR)) {
+        trace_event_record(TRACE_EVENT_ID_ISR, TRACE_EVENT_BEGIN, irq);
+    }
+}
+
+/**
+ * @brief   Records the exit of an interrupt service routine
+ *
+ * Does nothing without the `trace_event_isr` module.
+ *
+ * @param[in] irq   number of the interrupt
+ */
+static inline void trace_event_isr_exit(unsigned irq)
+{
+    if (IS_USED(MODULE_TRACE_EVENT_ISR)) {
+        trace_event_record(TRACE_EVENT_ID_ISR, TRACE_EVENT_END, irq);
+    }
+}
+
+/**
+ * @brief   Enables or disables recording
+ *
+ * Recording is enabled on start-up.
+ *
+ * @param[in] enable    true to record events, false to drop them
+ */
+void trace_event_enable(bool enable);
+
+/**
+ * @brief   Copies the recorded events, oldest first
+ *
+ * @param[out] events   destination
+ * @param[in] numof     maximum number of events to copy
+ *
+ * @return  number of events copied
+ */
+unsigned trace_event_get(trace_event_t *events, unsigned numof);
+
+/**
+ * @brief   Prints the recorded events
+ *
+ * Recording is paused while printing. Besides the events, the names of all
+ * threads are printed if @ref DEVELHELP is enabled. Example output:
+ *
+ *     trace_event: begin 3 events
+ *     thread 1 idle
+ *     thread 2 main
+ *     te 1815312 2 1 1 2
+ *     te 1815318 2 0 256 42
+ *     te 1815401 2 2 1 2
+ *     trace_event: end
+ *
+ * Each event line holds time, context, kind, ID and argument in decimal.
+ */
+void trace_event_dump(void);
+
+#if defined(CPU_NATIVE) || defined(DOXYGEN)
+/**
+ * @brief   Writes the recorded events into a file on the host
+ *
+ * The file starts with the 8 byte magic "RIOTTEV1", followed by
+ * @ref trace_event_t records, oldest first.
+ *
+ * @note    Only available on `native`.
+ *
+ * @param[in] path  path of the file on the host
+ *
+ * @return  number of events written
+ * @return  -errno on error
+ */
+int trace_event_dump_file(const char *path);
+#endif
+
+/**
+ * @brief   Drops all recorded events
+ */
+void trace_event_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_EVENT_H */
+/** @} */
@@ -288,6 +288,11 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
 /**
  * @brief Type of callbacks in @ref ztimer_t "timers"
  */
@@ -333,6 +338,10 @@ typedef struct {
     ztimer_base_t base;             /**< clock list entry */
     ztimer_callback_t callback;     /**< timer callback function pointer */
     void *arg;                      /**< timer callback argument */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **wheel_link;     /**< link pointing to this timer while it
+                                         is queued in a timing wheel        */
+#endif
 } ztimer_t;
 
 /**
@@ -403,6 +412,10 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timing wheel holding this clock's
+                                         timers, NULL for the sorted list   */
+#endif
 };
 
 /**
@@ -473,6 +486,33 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
  */
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
 
+/**
+ * @brief   Set a timer on a clock, allowing it to fire late
+ *
+ * Same as @ref ztimer_set(), but @p timer may fire anywhere between @p val
+ * and @p val + @p slack ticks from now. ztimer uses this freedom to fire
+ * timers together with other timers, so that one interrupt and one
+ * @ref ztimer_handler() pass serve them all.
+ *
+ * Use this for timers that don't need an exact deadline (e.g. periodic
+ * housekeeping), as it saves interrupts, context switches and wakeups.
+ *
+ * @note The memory pointed to by @p timer is not copied and must
+ *       remain in scope until the callback is fired or the timer
+ *       is removed via @ref ztimer_remove
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       maximum number of ticks the timer may fire
+ *                          later than @p val
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ *         (`now() + @p val` is the earliest absolute trigger time).
+ */
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack);
+
 /**
  * @brief   Check if a timer is currently active
  *
@@ -554,6 +594,37 @@ int ztimer_msg_receive_timeout(ztimer_clock_t *clock, msg_t *msg,
  */
 ztimer_now_t _ztimer_now_extend(ztimer_clock_t *clock);
 
+/**
+ * @brief   Set a timer on the sorted timer list of a clock
+ *
+ * @internal
+ *
+ * Same as @ref ztimer_set(), but never dispatches to a timing wheel attached
+ * to @p clock. Used by @ref sys_ztimer_wheel to arm its own clock timer.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+uint32_t _ztimer_list_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val);
+
+/**
+ * @brief   Remove a timer from the sorted timer list of a clock
+ *
+ * @internal
+ *
+ * Same as @ref ztimer_remove(), but never dispatches to a timing wheel
+ * attached to @p clock.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ * @param[in]   timer       timer entry to remove
+ *
+ * @return  true if the timer was removed
+ */
+bool _ztimer_list_remove(ztimer_clock_t *clock, ztimer_t *timer);
+
 /**
  * @brief asserts the given clock to be active
  *
@@ -95,6 +95,7 @@ typedef struct {
     ztimer_now_t last;                      /**< last trigger time                  */
     ztimer_periodic_callback_t callback;    /**< called on each trigger             */
     void *arg;                              /**< argument for callback              */
+    uint32_t slack;                         /**< ticks each trigger may be late     */
 } ztimer_periodic_t;
 
 /**
@@ -114,6 +115,27 @@ void ztimer_periodic_init(ztimer_clock_t *clock, ztimer_periodic_t *timer,
                           bool (*callback)(void *),
                           void *arg, uint32_t interval);
 
+/**
+ * @brief    Allow the triggers of a periodic timer to be late
+ *
+ * Each trigger may then happen up to @p slack ticks after its nominal time,
+ * so that it can be merged with other timers on the same clock (see
+ * @ref ztimer_set_with_slack()). The period itself doesn't drift, as every
+ * trigger is still scheduled relative to the previous nominal time.
+ *
+ * Call this after @ref ztimer_periodic_init(), it takes effect on the next
+ * (re)start or trigger.
+ *
+ * @param[inout]    timer       periodic timer object to configure
+ * @param[in]       slack       ticks each trigger may be late, must be
+ *                              smaller than the interval
+ */
+static inline void ztimer_periodic_set_slack(ztimer_periodic_t *timer,
+                                             uint32_t slack)
+{
+    timer->slack = slack;
+}
+
 /**
  * @brief    Start or restart a periodic timer
  *
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_ztimer_wheel ztimer hierarchical timing wheel
+ * @ingroup     sys_ztimer
+ * @brief       O(1) timer queue backend for ztimer clocks
+ *
+ * By default, every ztimer clock keeps its timers in a sorted delta list,
+ * which makes @ref ztimer_set() and @ref ztimer_remove() O(n) in the number
+ * of armed timers, with interrupts disabled for the whole walk. Clocks with
+ * many concurrently armed timers (e.g. ZTIMER_MSEC on a border router running
+ * NIB, RPL, gcoap and TCP) can instead be switched to a hierarchical timing
+ * wheel with @ref ztimer_wheel_init().
+ *
+ * The wheel has @ref CONFIG_ZTIMER_WHEEL_LEVELS levels of
+ * @ref ZTIMER_WHEEL_SLOTS slots each. A slot of level `n` spans
+ * `ZTIMER_WHEEL_SLOTS^n` clock ticks, so a timer is queued into a slot in
+ * O(1), and is moved ("cascaded") down one level at a time as its deadline
+ * approaches. Timers further away than the wheel's range wait in the last slot
+ * of the top level and are re-filed when that slot is reached. Timers still
+ * fire with the full resolution of the clock.
+ *
+ * The wheel is driven by a single timer on the clock's own list, which is
+ * armed for the next slot that needs processing only. Thus, a wheel with no
+ * timers costs nothing, and `ztimer_ondemand` and `pm_layered` continue to
+ * work as without the wheel.
+ *
+ * Use the pseudomodule `ztimer_msec_wheel` to have ZTIMER_MSEC switched to a
+ * timing wheel during @ref ztimer_init().
+ *
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel interface
+ */
+
+#ifndef ZTIMER_WHEEL_H
+#define ZTIMER_WHEEL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bits of the clock value covered by one wheel level
+ */
+#define ZTIMER_WHEEL_LEVEL_BITS     (5U)
+
+/**
+ * @brief   Number of slots per wheel level
+ */
+#define ZTIMER_WHEEL_SLOTS          (1U << ZTIMER_WHEEL_LEVEL_BITS)
+
+/**
+ * @brief   Number of levels of a timing wheel
+ *
+ * The wheel covers `2^(5 * CONFIG_ZTIMER_WHEEL_LEVELS)` clock ticks, and needs
+ * `ZTIMER_WHEEL_SLOTS * CONFIG_ZTIMER_WHEEL_LEVELS` pointers of RAM. Timers
+ * set further into the future are re-filed once per wheel range.
+ * Must be between 1 and 6.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LEVELS
+#define CONFIG_ZTIMER_WHEEL_LEVELS  (4U)
+#endif
+
+/**
+ * @brief   ztimer timing wheel structure
+ */
+struct ztimer_wheel {
+    ztimer_t timer;                 /**< clock timer driving the wheel      */
+    ztimer_clock_t *clock;          /**< clock this wheel is attached to    */
+    uint32_t base;                  /**< first clock tick not processed yet */
+    uint32_t target;                /**< tick @ref ztimer_wheel::timer is
+                                         armed for                          */
+    unsigned count;                 /**< number of timers in the wheel      */
+    bool armed;                     /**< true if @ref ztimer_wheel::timer is
+                                         set on the clock                   */
+    uint32_t pending[CONFIG_ZTIMER_WHEEL_LEVELS];   /**< bitmap of non-empty
+                                                         slots per level    */
+    ztimer_base_t *slots[CONFIG_ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+                                    /**< timer lists per level and slot     */
+};
+
+/**
+ * @brief   Attach a timing wheel to a clock
+ *
+ * After this call, all timers set on @p clock are kept in @p wheel.
+ *
+ * @pre     No timer is set on @p clock.
+ *
+ * @param[in]   clock       ztimer clock to switch to a timing wheel
+ * @param[out]  wheel       timing wheel to initialize
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel);
+
+/**
+ * @brief   Set a timer in a timing wheel
+ *
+ * @internal
+ *
+ * Called by @ref ztimer_set() and @ref ztimer_set_with_slack() for clocks with
+ * an attached wheel. Within the slack, the target tick with the coarsest
+ * alignment is picked, so that timers with overlapping windows end up on the
+ * same tick.
+ *
+ * @param[in]   wheel       timing wheel to operate on
+ * @param[in]   timer       timer entry to set
+ * @param[in]   val         timer target (relative ticks from now)
+ * @param[in]   slack       ticks the timer may fire later than @p val
+ *
+ * @return The value of @ref ztimer_now() that @p timer was set against
+ */
+uint32_t ztimer_wheel_set(ztimer_wheel_t *wheel, ztimer_t *timer, uint32_t val,
+                          uint32_t slack);
+
+/**
+ * @brief   Remove a timer from a timing wheel
+ *
+ * @internal
+ *
+ * Called by @ref ztimer_remove() for clocks with an attached wheel.
+ *
+ * @param[in]   wheel       timing wheel to operate on
+ * @param[in]   timer       timer entry to remove
+ *
+ * @return  true if the timer was removed
+ */
+bool ztimer_wheel_remove(ztimer_wheel_t *wheel, ztimer_t *timer);
+
+/**
+ * @brief   Check if a timer is queued in a timing wheel
+ *
+ * @internal
+ *
+ * @param[in]   wheel       timing wheel to operate on
+ * @param[in]   timer       timer to check
+ *
+ * @return  > 0 if timer is active
+ * @return 0 if timer is not active
+ */
+unsigned ztimer_wheel_is_set(const ztimer_wheel_t *wheel, const ztimer_t *timer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZTIMER_WHEEL_H */
+/** @} */
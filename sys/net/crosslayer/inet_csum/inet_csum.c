@@ -13,8 +13,11 @@
  */
 
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#include "byteorder.h"
+#include "cpu_conf.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
@@ -22,6 +25,75 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* word-wise access to the buffer, alignment is ensured by _csum_aligned() */
+typedef uint16_t __attribute__((may_alias)) _u16_alias_t;
+typedef uint32_t __attribute__((may_alias)) _u32_alias_t;
+
+#ifdef INET_CSUM_HAS_ARCH_SUM32
+#include "inet_csum_arch.h"
+#else
+/* Adds numof 32-bit words in host byte order. The carries are accumulated
+ * in the upper half of a 64-bit sum and only folded back once at the end. */
+static inline uint32_t inet_csum_arch_sum32(uint32_t sum, const void *words,
+                                            size_t numof)
+{
+    const _u32_alias_t *w = words;
+    uint64_t acc = sum;
+
+    while (numof >= 4) {
+        acc += w[0];
+        acc += w[1];
+        acc += w[2];
+        acc += w[3];
+        w += 4;
+        numof -= 4;
+    }
+    while (numof--) {
+        acc += *(w++);
+    }
+    acc = (acc & UINT32_MAX) + (acc >> 32);
+    acc = (acc & UINT32_MAX) + (acc >> 32);
+    return acc;
+}
+#endif
+
+static inline uint16_t _fold(uint32_t csum)
+{
+    csum = (csum & 0xffff) + (csum >> 16);
+    csum = (csum & 0xffff) + (csum >> 16);
+    return csum;
+}
+
+/* Sums a buffer starting at an even offset of the checksum domain. buf needs
+ * to be 16-bit aligned. The words are added in host byte order, which yields
+ * the byte-swapped checksum on little endian platforms (see RFC 1071,
+ * section 2 (B)). */
+static uint16_t _csum_aligned(const uint8_t *buf, size_t len)
+{
+    uint32_t csum = 0;
+
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        csum += *((const _u16_alias_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+    csum = inet_csum_arch_sum32(csum, buf, len >> 2);
+    buf += len & ~0x3U;
+    if (len & 2) {
+        csum = _fold(csum);
+        csum += *((const _u16_alias_t *)buf);
+        buf += 2;
+    }
+    if (len & 1) {
+        /* pad last byte to a 16-bit word in memory order */
+        uint8_t tmp[2] = { *buf, 0 };
+
+        csum = _fold(csum);
+        csum += *((const _u16_alias_t *)tmp);
+    }
+    return ntohs(_fold(csum));
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,22 +116,23 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if ((uintptr_t)buf & 1) {
+        if (len > 0) {
+            /* add first byte as top half of 16-bit word and sum the rest,
+             * which is aligned again, as if it was at an even offset: this
+             * results in the byte-swapped sum of the rest */
+            csum += (uint16_t)(*buf << 8);
+            csum += byteorder_swaps(_csum_aligned(buf + 1, len - 1));
+        }
     }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
+    else {
+        csum += _csum_aligned(buf, len);
     }
 
+    csum = _fold(csum);
+
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
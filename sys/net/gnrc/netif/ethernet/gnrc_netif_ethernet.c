@@ -34,6 +34,8 @@
 #endif
 
 static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+static void _send_burst(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[], int res[],
+                        unsigned numof);
 static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif);
 #ifdef MODULE_GNRC_SIXLOENC
 static int _set(gnrc_netif_t *netif, const gnrc_netapi_opt_t *opt);
@@ -49,6 +51,7 @@ static const gnrc_netif_ops_t ethernet_ops = {
     .recv = _recv,
     .get = gnrc_netif_get_from_netdev,
     .set = _set,
+    .send_burst = IS_USED(MODULE_GNRC_NETIF_TX_BURST) ? _send_burst : NULL,
 };
 
 int gnrc_netif_ethernet_create(gnrc_netif_t *netif, char *stack, int stacksize,
@@ -81,12 +84,11 @@ static inline void _addr_set_multicast(gnrc_netif_t *netif, uint8_t *dst,
     }
 }
 
-static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+static int _build_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                      ethernet_hdr_t *hdr)
 {
-    ethernet_hdr_t hdr;
     gnrc_netif_hdr_t *netif_hdr;
     gnrc_pktsnip_t *payload;
-    int res;
 
     netdev_t *dev = netif->dev;
 
@@ -103,25 +105,25 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
 
     if (payload) {
-        hdr.type = byteorder_htons(gnrc_nettype_to_ethertype(payload->type));
+        hdr->type = byteorder_htons(gnrc_nettype_to_ethertype(payload->type));
     }
     else {
-        hdr.type = byteorder_htons(ETHERTYPE_UNKNOWN);
+        hdr->type = byteorder_htons(ETHERTYPE_UNKNOWN);
     }
 
     netif_hdr = pkt->data;
 
     /* set ethernet header */
     if (netif_hdr->src_l2addr_len == ETHERNET_ADDR_LEN) {
-        memcpy(hdr.dst, gnrc_netif_hdr_get_src_addr(netif_hdr),
+        memcpy(hdr->dst, gnrc_netif_hdr_get_src_addr(netif_hdr),
                netif_hdr->src_l2addr_len);
     }
     else {
-        dev->driver->get(dev, NETOPT_ADDRESS, hdr.src, ETHERNET_ADDR_LEN);
+        dev->driver->get(dev, NETOPT_ADDRESS, hdr->src, ETHERNET_ADDR_LEN);
     }
 
     if (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_BROADCAST) {
-        _addr_set_broadcast(hdr.dst);
+        _addr_set_broadcast(hdr->dst);
     }
     else if (netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_MULTICAST) {
         if (payload == NULL) {
@@ -129,10 +131,10 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
                   "are not yet supported\n");
             return -ENOTSUP;
         }
-        _addr_set_multicast(netif, hdr.dst, payload);
+        _addr_set_multicast(netif, hdr->dst, payload);
     }
     else if (netif_hdr->dst_l2addr_len == ETHERNET_ADDR_LEN) {
-        memcpy(hdr.dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+        memcpy(hdr->dst, gnrc_netif_hdr_get_dst_addr(netif_hdr),
                ETHERNET_ADDR_LEN);
     }
     else {
@@ -142,14 +144,8 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     }
 
     DEBUG("gnrc_netif_ethernet: send to %02x:%02x:%02x:%02x:%02x:%02x\n",
-          hdr.dst[0], hdr.dst[1], hdr.dst[2],
-          hdr.dst[3], hdr.dst[4], hdr.dst[5]);
-
-    iolist_t iolist = {
-        .iol_next = (iolist_t *)payload,
-        .iol_base = &hdr,
-        .iol_len = sizeof(ethernet_hdr_t)
-    };
+          hdr->dst[0], hdr->dst[1], hdr->dst[2],
+          hdr->dst[3], hdr->dst[4], hdr->dst[5]);
 
 #ifdef MODULE_NETSTATS_L2
     if ((netif_hdr->flags & GNRC_NETIF_HDR_FLAGS_BROADCAST) ||
@@ -160,6 +156,25 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
         netif->stats.tx_unicast_count++;
     }
 #endif
+    return 0;
+}
+
+static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    ethernet_hdr_t hdr;
+    netdev_t *dev = netif->dev;
+    int res = _build_hdr(netif, pkt, &hdr);
+
+    if (res < 0) {
+        return res;
+    }
+
+    iolist_t iolist = {
+        .iol_next = (iolist_t *)pkt->next,
+        .iol_base = &hdr,
+        .iol_len = sizeof(ethernet_hdr_t)
+    };
+
     res = dev->driver->send(dev, &iolist);
 
     if (gnrc_netif_netdev_legacy_api(netif)) {
@@ -170,28 +185,71 @@ static int _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     return res;
 }
 
-static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+static void _send_burst(gnrc_netif_t *netif, gnrc_pktsnip_t *pkts[], int res[],
+                        unsigned numof)
 {
-    netdev_t *dev = netif->dev;
-    gnrc_pktsnip_t *pkt = NULL;
-    netdev_eth_rx_info_t rx_info = { .flags = 0 };
-    int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
+    ethernet_hdr_t hdr[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    iolist_t iolist[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    const iolist_t *frames[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    /* index into pkts of each frame */
+    uint8_t idx[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    unsigned frames_numof = 0;
+    int sent = 0;
+
+    assert(numof <= CONFIG_GNRC_NETIF_TX_BURST_MAX);
+    for (unsigned i = 0; i < numof; i++) {
+        res[i] = _build_hdr(netif, pkts[i], &hdr[frames_numof]);
+        if (res[i] < 0) {
+            gnrc_pktbuf_release(pkts[i]);
+            continue;
+        }
+        iolist[frames_numof].iol_next = (iolist_t *)pkts[i]->next;
+        iolist[frames_numof].iol_base = &hdr[frames_numof];
+        iolist[frames_numof].iol_len = sizeof(ethernet_hdr_t);
+        frames[frames_numof] = &iolist[frames_numof];
+        idx[frames_numof++] = i;
+    }
 
-    if (bytes_expected > 0) {
-        pkt = gnrc_pktbuf_add(NULL, NULL,
-                              bytes_expected,
-                              GNRC_NETTYPE_UNDEF);
+    if (frames_numof > 0) {
+        sent = netdev_send_burst(netif->dev, frames, frames_numof);
+    }
+    for (unsigned i = 0; i < frames_numof; i++) {
+        if ((int)i < sent) {
+            res[idx[i]] = iolist_size(frames[i]);
+        }
+        else if ((i == 0) && (sent < 0)) {
+            res[idx[i]] = sent;
+        }
+        else {
+            res[idx[i]] = -EBUSY;
+        }
+        /* only legacy devices get bursts, so release here as in _send() */
+        gnrc_pktbuf_release(pkts[idx[i]]);
+    }
+}
 
-        if (!pkt) {
-            DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+static void *_rx_alloc(void *arg, size_t len)
+{
+    gnrc_pktsnip_t **pkt = arg;
 
-            /* drop the packet */
-            dev->driver->recv(dev, NULL, bytes_expected, NULL);
+    *pkt = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (*pkt == NULL) {
+        DEBUG("gnrc_netif_ethernet: cannot allocate pktsnip.\n");
+        return NULL;
+    }
+    return (*pkt)->data;
+}
 
-            goto out;
-        }
+static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
+{
+    netdev_t *dev = netif->dev;
+    gnrc_pktsnip_t *pkt = NULL;
+    netdev_eth_rx_info_t rx_info = { .flags = 0 };
+    /* receives straight into the packet buffer with a single driver call if
+     * the driver supports it */
+    int nread = netdev_recv_alloc(dev, _rx_alloc, &pkt, &rx_info);
 
-        int nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+    if (pkt != NULL) {
         if (nread <= 0) {
             DEBUG("gnrc_netif_ethernet: read error.\n");
             goto safe_out;
@@ -201,7 +259,7 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         netif->stats.rx_bytes += nread;
 #endif
 
-        if (nread < bytes_expected) {
+        if ((size_t)nread < pkt->size) {
             /* we've got less than the expected packet size,
              * so free the unused space.*/
 
@@ -258,7 +316,6 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         pkt = gnrc_pkt_append(pkt, netif_hdr);
     }
 
-out:
     return pkt;
 
 safe_out:
@@ -27,13 +27,16 @@
 #include "net/gnrc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/ipv6.h"
+#include "net/gnrc/pktlat.h"
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
 #include "net/gnrc/netif/pktq.h"
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
+#include "net/gnrc/netif/rx_poll.h"
 #include "net/gnrc/sixlowpan/ctx.h"
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR)
 #include "net/gnrc/sixlowpan/frag/sfr.h"
 #endif /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#include "net/gnrc/sixlowpan/iphc.h"
 #include "net/netstats.h"
 #include "net/netstats/neighbor.h"
 #include "fmt.h"
@@ -209,6 +212,14 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                        sizeof(netif->stats));
                 res = sizeof(netif->stats);
                 break;
+#endif
+#if IS_USED(MODULE_GNRC_PKTLAT)
+            case NETSTATS_PKTLAT:
+                /* the histograms are shared by all interfaces */
+                assert(opt->data_len == sizeof(gnrc_pktlat_stats_t));
+                gnrc_pktlat_get_all(opt->data);
+                res = sizeof(gnrc_pktlat_stats_t);
+                break;
 #endif
             default:
                 /* take from device */
@@ -443,6 +454,12 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 memset(&netif->stats, 0, sizeof(netif->stats));
                 res = 0;
                 break;
+#endif
+#if IS_USED(MODULE_GNRC_PKTLAT)
+            case NETSTATS_PKTLAT:
+                gnrc_pktlat_reset();
+                res = 0;
+                break;
 #endif
             default:
                 /* take from device */
@@ -1475,6 +1492,8 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif)
     if (res > 0) {
         netif->l2addr_len = res;
     }
+    /* the IID compressed addresses are derived from may have changed */
+    gnrc_sixlowpan_iphc_cache_invalidate();
 }
 
 static void _init_from_device(gnrc_netif_t *netif)
@@ -1669,6 +1688,7 @@ static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
     netif->dev->driver->isr(netif->dev);
+    gnrc_netif_rx_poll_isr_done(netif);
 }
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
@@ -1843,8 +1863,42 @@ static void _event_handler_tx_done(event_t *evp)
 }
 #endif
 
+/**
+ * @brief   Prepares a packet to be handed to gnrc_netif_ops_t::send
+ *
+ * @param[in]   netif   the network interface
+ * @param[in]   pkt     the packet
+ *
+ * @return  the TX sync snip split off @p pkt, if any
+ */
+static gnrc_pktsnip_t *_tx_prepare(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    /* Record send in neighbor statistics if destination is unicast */
+    if (IS_USED(MODULE_NETSTATS_NEIGHBOR)) {
+        gnrc_netif_hdr_t *netif_hdr = pkt->data;
+        if (netif_hdr->flags &
+            (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
+            DEBUG("l2 stats: Destination is multicast or unicast, NULL recorded\n");
+            netstats_nb_record(&netif->netif, NULL, 0);
+        } else {
+            DEBUG("l2 stats: recording transmission\n");
+            netstats_nb_record(&netif->netif,
+                               gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                               netif_hdr->dst_l2addr_len);
+        }
+    }
+
+    /* Split off the TX sync snip */
+    gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
+                            ? gnrc_tx_sync_split(pkt) : NULL;
+    /* legacy drivers release pkt in send() */
+    gnrc_pktlat_done(pkt, GNRC_PKTLAT_NETIF_TX);
+    return tx_sync;
+}
+
 static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 {
+    gnrc_pktlat_stamp(pkt, GNRC_PKTLAT_NETIF_TX);
 #if IS_USED(MODULE_NETDEV_NEW_API)
     if (netif->tx_pkt != NULL) {
         /* Upper layer is handing out frames faster than hardware can transmit.
@@ -1884,24 +1938,7 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
     gnrc_pktbuf_hold(pkt, 1);
 #endif /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
 
-    /* Record send in neighbor statistics if destination is unicast */
-    if (IS_USED(MODULE_NETSTATS_NEIGHBOR)) {
-        gnrc_netif_hdr_t *netif_hdr = pkt->data;
-        if (netif_hdr->flags &
-            (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
-            DEBUG("l2 stats: Destination is multicast or unicast, NULL recorded\n");
-            netstats_nb_record(&netif->netif, NULL, 0);
-        } else {
-            DEBUG("l2 stats: recording transmission\n");
-            netstats_nb_record(&netif->netif,
-                               gnrc_netif_hdr_get_dst_addr(netif_hdr),
-                               netif_hdr->dst_l2addr_len);
-        }
-    }
-
-    /* Split off the TX sync snip */
-    gnrc_pktsnip_t *tx_sync = IS_USED(MODULE_GNRC_TX_SYNC)
-                            ? gnrc_tx_sync_split(pkt) : NULL;
+    gnrc_pktsnip_t *tx_sync = _tx_prepare(netif, pkt);
     int res = netif->ops->send(netif, pkt);
 
     /* For legacy netdevs (no confirm_send) TX is blocking, thus it is always
@@ -1925,6 +1962,65 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
 #endif
 }
 
+/**
+ * @brief   Sends the packet of a send request and all send requests waiting
+ *          in the message queue in one burst
+ *
+ * @param[in]       netif   the network interface
+ * @param[in,out]   msg     the send request. Holds the first other message
+ *                          taken from the message queue on return
+ *
+ * @return  true, if @p msg holds a message that still needs to be handled
+ */
+static bool _send_burst(gnrc_netif_t *netif, msg_t *msg)
+{
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    gnrc_pktsnip_t *tx_sync[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    int res[CONFIG_GNRC_NETIF_TX_BURST_MAX];
+    unsigned numof = 0;
+    bool pending = false;
+
+    pkts[numof++] = msg->content.ptr;
+    /* only legacy devices complete TX within send() and queued packets need
+     * to go first to keep the order */
+    if ((netif->ops->send_burst == NULL) ||
+        gnrc_netif_netdev_new_api(netif)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+        || !gnrc_netif_pktq_empty(netif)
+#endif
+        ) {
+        _send(netif, pkts[0], false);
+        return false;
+    }
+    while ((numof < CONFIG_GNRC_NETIF_TX_BURST_MAX) &&
+           (msg_try_receive(msg) > 0)) {
+        if (msg->type != GNRC_NETAPI_MSG_TYPE_SND) {
+            pending = true;
+            break;
+        }
+        pkts[numof++] = msg->content.ptr;
+    }
+    if (numof == 1) {
+        _send(netif, pkts[0], false);
+        return pending;
+    }
+
+    DEBUG("gnrc_netif: sending burst of %u packets\n", numof);
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktlat_stamp(pkts[i], GNRC_PKTLAT_NETIF_TX);
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+        /* see _send() */
+        gnrc_pktbuf_hold(pkts[i], 1);
+#endif
+        tx_sync[i] = _tx_prepare(netif, pkts[i]);
+    }
+    netif->ops->send_burst(netif, pkts, res, numof);
+    for (unsigned i = 0; i < numof; i++) {
+        _tx_done(netif, pkts[i], tx_sync[i], res[i], false);
+    }
+    return pending;
+}
+
 static void *_gnrc_netif_thread(void *args)
 {
     _netif_ctx_t *ctx = args;
@@ -1958,17 +2054,24 @@ static void *_gnrc_netif_thread(void *args)
 #ifdef MODULE_NETSTATS_L2
     memset(&netif->stats, 0, sizeof(netstats_t));
 #endif
+    gnrc_netif_rx_poll_init(netif);
     /* now let rest of GNRC use the interface */
     gnrc_netif_release(netif);
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
     uint32_t last_wakeup = ztimer_now(ZTIMER_USEC);
 #endif
 
+    msg_t msg;
+    bool msg_pending = false;
+
     while (1) {
-        msg_t msg;
         /* msg will be filled by _process_events_await_msg.
-         * The function will not return until a message has been received. */
-        _process_events_await_msg(netif, &msg);
+         * The function will not return until a message has been received.
+         * A burst send may have left a message to handle already. */
+        if (!msg_pending) {
+            _process_events_await_msg(netif, &msg);
+        }
+        msg_pending = false;
 
         /* dispatch netdev, MAC and gnrc_netapi messages */
         DEBUG("gnrc_netif: message %u\n", (unsigned)msg.type);
@@ -1981,7 +2084,12 @@ static void *_gnrc_netif_thread(void *args)
 #endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(netif, msg.content.ptr, false);
+                if (IS_USED(MODULE_GNRC_NETIF_TX_BURST)) {
+                    msg_pending = _send_burst(netif, &msg);
+                }
+                else {
+                    _send(netif, msg.content.ptr, false);
+                }
 #if (CONFIG_GNRC_NETIF_MIN_WAIT_AFTER_SEND_US > 0U)
                 ztimer_periodic_wakeup(
                         ZTIMER_USEC,
@@ -2042,6 +2150,11 @@ static void *_gnrc_netif_thread(void *args)
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_RX_FASTPATH)
+    if (gnrc_ipv6_receive_fastpath(pkt)) {
+        return;
+    }
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -2083,12 +2196,14 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 }
                 break;
             case NETDEV_EVENT_RX_COMPLETE:
+                gnrc_netif_rx_poll_rx(netif);
                 pkt = netif->ops->recv(netif);
                 /* send packet previously queued within netif due to the lower
                  * layer being busy.
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
+                    gnrc_pktlat_stamp(pkt, GNRC_PKTLAT_NETIF_RX);
                     _process_receive_stats(netif, pkt);
                     _pass_on_packet(pkt);
                 }
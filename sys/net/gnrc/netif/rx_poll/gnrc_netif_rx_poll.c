@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+
+#include "container.h"
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/rx_poll.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _set_rx_irq(gnrc_netif_t *netif, bool enable)
+{
+    netopt_enable_t value = enable ? NETOPT_ENABLE : NETOPT_DISABLE;
+
+    return netif->dev->driver->set(netif->dev, NETOPT_RX_END_IRQ, &value,
+                                   sizeof(value));
+}
+
+static void _to_irq(gnrc_netif_t *netif)
+{
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    DEBUG("gnrc_netif_rx_poll: switching to interrupt mode on %u\n",
+          netif->pid);
+    ztimer_remove(ZTIMER_USEC, &poll->timer);
+    _set_rx_irq(netif, true);
+    poll->polling = false;
+    poll->to_irq++;
+    poll->rx = 0;
+    poll->window_start = ztimer_now(ZTIMER_USEC);
+}
+
+static void _to_poll(gnrc_netif_t *netif)
+{
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    if (_set_rx_irq(netif, false) < 0) {
+        DEBUG("gnrc_netif_rx_poll: device of %u can't disable RX interrupt\n",
+              netif->pid);
+        poll->threshold = 0;
+        return;
+    }
+    DEBUG("gnrc_netif_rx_poll: switching to polled mode on %u\n", netif->pid);
+    poll->polling = true;
+    poll->to_poll++;
+    ztimer_set(ZTIMER_USEC, &poll->timer, CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US);
+}
+
+static void _poll(event_t *evp)
+{
+    gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, rx_poll.event);
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    if (!poll->polling) {
+        return;
+    }
+    poll->rx = 0;
+    while (poll->rx < poll->budget) {
+        uint16_t rx = poll->rx;
+
+        netif->dev->driver->isr(netif->dev);
+        if (poll->rx == rx) {
+            /* no more frames */
+            break;
+        }
+    }
+    if ((poll->rx == 0) || (poll->threshold == 0)) {
+        _to_irq(netif);
+    }
+    else {
+        ztimer_set(ZTIMER_USEC, &poll->timer,
+                   CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US);
+    }
+}
+
+static void _timer_cb(void *arg)
+{
+    gnrc_netif_t *netif = arg;
+
+    event_post(&netif->evq[GNRC_NETIF_EVQ_INDEX_PRIO_LOW],
+               &netif->rx_poll.event);
+}
+
+void gnrc_netif_rx_poll_init(gnrc_netif_t *netif)
+{
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    poll->event.handler = _poll;
+    poll->timer.callback = _timer_cb;
+    poll->timer.arg = netif;
+    poll->threshold = CONFIG_GNRC_NETIF_RX_POLL_THRESHOLD;
+    poll->budget = CONFIG_GNRC_NETIF_RX_POLL_BUDGET;
+    poll->window_start = ztimer_now(ZTIMER_USEC);
+}
+
+void gnrc_netif_rx_poll_set(gnrc_netif_t *netif, uint16_t threshold,
+                            uint16_t budget)
+{
+    assert(budget > 0);
+    /* a disabled interface in polled mode switches back after its next poll
+     * round */
+    netif->rx_poll.threshold = threshold;
+    netif->rx_poll.budget = budget;
+}
+
+void gnrc_netif_rx_poll_rx(gnrc_netif_t *netif)
+{
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    if (!poll->polling) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        if ((now - poll->window_start) >= CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US) {
+            poll->window_start = now;
+            poll->rx = 0;
+        }
+    }
+    if (poll->rx < UINT16_MAX) {
+        poll->rx++;
+    }
+}
+
+void gnrc_netif_rx_poll_isr_done(gnrc_netif_t *netif)
+{
+    gnrc_netif_rx_poll_t *poll = &netif->rx_poll;
+
+    if (!poll->polling && (poll->threshold > 0) &&
+        (poll->rx >= poll->threshold)) {
+        _to_poll(netif);
+    }
+}
+
+/** @} */
@@ -31,8 +31,10 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+#define _BUCKETS_NUMOF      (1U << CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP)
+
+/* The registry as lookup table by gnrc_nettype_t and hash of demux_ctx */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][_BUCKETS_NUMOF];
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,7 +65,21 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
+}
+
+/* list of entries of type that may have demux_ctx */
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+#if CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP
+    /* Knuth's multiplicative hash, take the upper bits as they are mixed
+     * best */
+    demux_ctx = (demux_ctx * 2654435761U) >> (32 - CONFIG_GNRC_NETREG_HASH_BUCKETS_EXP);
+#else
+    demux_ctx = 0;
+#endif
+    return &netreg[type][demux_ctx];
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -151,15 +167,17 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+    gnrc_netreg_entry_t **list = _bucket(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
 
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*list, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*list, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -171,8 +189,10 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+    gnrc_netreg_entry_t **list = _bucket(type, entry->demux_ctx);
+
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*list, entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +234,10 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        /* entries with the same demux_ctx are in the same list, so the
+         * remaining ones follow from */
+        gnrc_netreg_entry_t *head = (from) ? from->next
+                                           : *_bucket(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
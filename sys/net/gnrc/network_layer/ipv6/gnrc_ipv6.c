@@ -32,6 +32,8 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
+#include "net/gnrc/pktlat.h"
+#include "net/gnrc/udp.h"
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
@@ -197,11 +199,13 @@ static void *_event_loop(void *args)
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+                gnrc_pktlat_stamp(msg.content.ptr, GNRC_PKTLAT_IPV6_RX);
                 _receive(msg.content.ptr);
                 break;
 
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+                gnrc_pktlat_stamp(msg.content.ptr, GNRC_PKTLAT_IPV6_TX);
                 _send(msg.content.ptr, true);
                 break;
 
@@ -725,6 +729,25 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
 }
 
 /* functions for receiving */
+static inline void _count_rx(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                             gnrc_pktsnip_t *netif_hdr)
+{
+#ifdef MODULE_NETSTATS_IPV6
+    assert(netif != NULL);
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netstats_t *stats = &netif->ipv6.stats;
+    stats->rx_count++;
+    stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
+    irq_restore(irq_state);
+#else
+    (void)netif;
+    (void)pkt;
+    (void)netif_hdr;
+#endif
+}
+
 static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
 {
     if (ipv6_addr_is_loopback(&hdr->dst)) {
@@ -753,16 +776,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
     if (netif_hdr != NULL) {
         netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
-#ifdef MODULE_NETSTATS_IPV6
-        assert(netif != NULL);
-        /* This is read from the netif thread. To prevent data corruptions, we
-         * have to guarantee mutually exclusive access */
-        unsigned irq_state = irq_disable();
-        netstats_t *stats = &netif->ipv6.stats;
-        stats->rx_count++;
-        stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
-        irq_restore(irq_state);
-#endif
+        _count_rx(netif, pkt, netif_hdr);
     }
 
     if ((pkt->data == NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
@@ -920,4 +934,90 @@ static void _receive(gnrc_pktsnip_t *pkt)
     _demux(netif, pkt, first_nh);
 }
 
+#if IS_USED(MODULE_GNRC_RX_FASTPATH)
+/* checks if pkt can skip the IPv6 and UDP threads without any of them or
+ * another subscriber missing out on it, without touching pkt */
+static bool _fastpath_applicable(gnrc_pktsnip_t *pkt)
+{
+    ipv6_hdr_t *hdr = pkt->data;
+
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (pkt->data == NULL) ||
+        (pkt->size < sizeof(ipv6_hdr_t)) || !ipv6_hdr_is(pkt->data)) {
+        return false;
+    }
+    /* leave extension headers, ICMPv6, multicast, loopback and anything that
+     * needs an error reply to the IPv6 thread */
+    uint16_t ipv6_len = byteorder_ntohs(hdr->len);
+    if ((hdr->nh != PROTNUM_UDP) || (hdr->hl == 0) ||
+        (ipv6_len < sizeof(udp_hdr_t)) ||
+        (ipv6_len > (pkt->size - sizeof(ipv6_hdr_t))) ||
+        ipv6_addr_is_multicast(&hdr->dst) ||
+        ipv6_addr_is_loopback(&hdr->dst)) {
+        return false;
+    }
+#ifdef MODULE_GNRC_IPV6_WHITELIST
+    if (!gnrc_ipv6_whitelisted(&hdr->src)) {
+        return false;
+    }
+#endif
+#ifdef MODULE_GNRC_IPV6_BLACKLIST
+    if (gnrc_ipv6_blacklisted(&hdr->src)) {
+        return false;
+    }
+#endif
+    /* the IPv6 and UDP threads must be the only ones interested */
+    if ((gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) != 1) ||
+        (gnrc_netreg_num(GNRC_NETTYPE_IPV6, PROTNUM_UDP) != 0) ||
+        (gnrc_netreg_num(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL) != 1)) {
+        return false;
+    }
+    /* packets to be forwarded are left to the IPv6 thread */
+    return (gnrc_netif_get_by_ipv6_addr(&hdr->dst) != NULL);
+}
+
+bool gnrc_ipv6_receive_fastpath(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *ipv6, *netif_hdr;
+
+    assert(pkt != NULL);
+
+    if (!_fastpath_applicable(pkt)) {
+        return false;
+    }
+    gnrc_pktlat_stamp(pkt, GNRC_PKTLAT_IPV6_RX);
+
+    netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif_hdr != NULL) {
+        _count_rx(gnrc_netif_hdr_get_netif(netif_hdr->data), pkt, netif_hdr);
+    }
+
+    /* from here on, this is _receive() for the cases checked above */
+    ipv6 = gnrc_pktbuf_start_write(pkt);
+    if (ipv6 == NULL) {
+        DEBUG("ipv6: unable to get write access to packet, drop it\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    pkt = ipv6;
+    ipv6 = gnrc_pktbuf_mark(pkt, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        DEBUG("ipv6: error marking IPv6 header, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+
+    uint16_t ipv6_len = byteorder_ntohs(((ipv6_hdr_t *)ipv6->data)->len);
+    /* remove any padding added by lower layers */
+    if (ipv6_len < pkt->size) {
+        gnrc_pktbuf_realloc_data(pkt, ipv6_len);
+    }
+
+    DEBUG("ipv6: fast path for UDP datagram of length %" PRIu16 "\n",
+          ipv6_len);
+    pkt->type = GNRC_NETTYPE_UDP;
+    gnrc_udp_demux(pkt);
+    return true;
+}
+#endif  /* MODULE_GNRC_RX_FASTPATH */
+
 /** @} */
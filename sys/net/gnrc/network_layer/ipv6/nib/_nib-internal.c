@@ -28,6 +28,7 @@
 #include "random.h"
 
 #include "_nib-internal.h"
+#include "_nib-lpm.h"
 #include "_nib-router.h"
 
 #define ENABLE_DEBUG 0
@@ -38,6 +39,13 @@ _nib_dr_entry_t *_prime_def_router = NULL;
 static clist_node_t _next_removable = { NULL };
 
 static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+/* on-link entries by hash of their address. Both arrays hold an index + 1
+ * into _nodes, _onl_hnext[i] is 0 if _nodes[i] is not in the index */
+static uint16_t _onl_buckets[CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS];
+static uint16_t _onl_hnext[CONFIG_GNRC_IPV6_NIB_NUMOF];
+#define _ONL_HASH_END   (UINT16_MAX)
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
@@ -60,8 +68,13 @@ void _nib_init(void)
     _prime_def_router = NULL;
     _next_removable.next = NULL;
     memset(_nodes, 0, sizeof(_nodes));
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+    memset(_onl_buckets, 0, sizeof(_onl_buckets));
+    memset(_onl_hnext, 0, sizeof(_onl_hnext));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+    _nib_lpm_init();
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -87,6 +100,95 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+static inline uint16_t *_onl_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* Knuth's multiplicative hash to mix the interface identifier */
+    hash *= 2654435761U;
+    return &_onl_buckets[(hash >> 16) % CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS];
+}
+
+static void _onl_index_remove(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+
+    if (_onl_hnext[idx] == 0) {
+        return;
+    }
+    for (uint16_t *ptr = _onl_bucket(&node->ipv6); *ptr != _ONL_HASH_END;
+         ptr = &_onl_hnext[*ptr - 1]) {
+        if (*ptr == (idx + 1)) {
+            *ptr = _onl_hnext[idx];
+            break;
+        }
+    }
+    _onl_hnext[idx] = 0;
+}
+
+static void _onl_index_add(_nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+    uint16_t *bucket = _onl_bucket(&node->ipv6);
+
+    assert(_onl_hnext[idx] == 0);
+    _onl_hnext[idx] = (*bucket) ? *bucket : _ONL_HASH_END;
+    *bucket = idx + 1;
+}
+
+/* returns the entry with address addr that comes first in _nodes, as the
+ * linear search would. For alloc, the interface must be equal to iface and
+ * empty entries are included, otherwise the matching is as in _nib_onl_get() */
+static _nib_onl_entry_t *_onl_index_get(const ipv6_addr_t *addr,
+                                        unsigned iface, bool alloc)
+{
+    _nib_onl_entry_t *res = NULL;
+    uint16_t ref = *_onl_bucket(addr);
+
+    if (ref == 0) {
+        return NULL;
+    }
+    for (; ref != _ONL_HASH_END; ref = _onl_hnext[ref - 1]) {
+        _nib_onl_entry_t *node = &_nodes[ref - 1];
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        if (((res == NULL) || (node < res)) &&
+            (alloc || (node->mode != _EMPTY)) &&
+            ((node_iface == iface) ||
+             (!alloc && ((node_iface == 0) || (iface == 0)))) &&
+            ipv6_addr_equal(&node->ipv6, addr)) {
+            res = node;
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
+#define _onl_index_remove(node)     (void)node
+#define _onl_index_add(node)        (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
+
+/* (re-)sets the address of node, NULL to keep it */
+static void _nib_onl_set_addr(_nib_onl_entry_t *node, const ipv6_addr_t *addr)
+{
+    _onl_index_remove(node);
+    if (addr != NULL) {
+        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+    }
+    _onl_index_add(node);
+}
+
+bool _nib_onl_clear(_nib_onl_entry_t *node)
+{
+    if (node->mode == _EMPTY) {
+        _onl_index_remove(node);
+        memset(node, 0, sizeof(_nib_onl_entry_t));
+        return true;
+    }
+    return false;
+}
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +196,26 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+    /* with iface == 0, cleared entries would count as exact match as well */
+    if ((addr != NULL) && (iface != 0)) {
+        _nib_onl_entry_t *unspec;
+
+        node = _onl_index_get(addr, iface, true);
+        unspec = _onl_index_get(&ipv6_addr_unspecified, iface, true);
+        if ((node == NULL) || ((unspec != NULL) && (unspec < node))) {
+            node = unspec;
+        }
+        for (unsigned i = 0; (node == NULL) && (i < CONFIG_GNRC_IPV6_NIB_NUMOF);
+             i++) {
+            if (_nodes[i].mode == _EMPTY) {
+                DEBUG("  using %p\n", (void *)&_nodes[i]);
+                node = &_nodes[i];
+            }
+        }
+    }
+    else
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -219,6 +341,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS
+    _nib_onl_entry_t *node = _onl_index_get(addr, iface, false);
+
+    DEBUG("  %s %p\n", (node) ? "Found" : "No suitable entry found",
+          (void *)node);
+    return node;
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -234,6 +363,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     }
     DEBUG("  No suitable entry found\n");
     return NULL;
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS */
 }
 
 void _nib_nc_set_reachable(_nib_onl_entry_t *node)
@@ -493,7 +623,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
-                memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _nib_onl_set_addr(tmp_node, next_hop);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +644,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_lpm_add(dst);
     }
     return dst;
 }
@@ -550,6 +681,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_lpm_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -575,6 +707,9 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
 
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    return _nib_lpm_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     _nib_offl_entry_t *res = NULL;
     uint8_t best_match = 0;
 
@@ -600,6 +735,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -857,9 +993,7 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
-    if (addr != NULL) {
-        memcpy(&node->ipv6, addr, sizeof(node->ipv6));
-    }
+    _nib_onl_set_addr(node, addr);
     _nib_onl_set_if(node, iface);
 }
 
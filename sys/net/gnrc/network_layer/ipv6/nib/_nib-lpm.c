@@ -0,0 +1,241 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Path-compressed binary trie over the prefixes of the off-link
+ *          entries
+ *
+ * Every node stands for the prefix of length _nib_lpm_node_t::len shared by
+ * all entries below it. A node either refers to the off-link entry with
+ * exactly that prefix, or is a pure branching node with two children. The
+ * prefix bits of a node are not stored but taken from the first entry found
+ * below it, and only checked against the destination at nodes with an entry.
+ */
+
+#include <assert.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+#include "_nib-lpm.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+/**
+ * @brief   Trie node
+ */
+typedef struct {
+    _nib_offl_entry_t *entry;   /**< entry with the node's prefix or NULL */
+    uint16_t child[2];          /**< index + 1 of the child for the next bit
+                                 *   being 0 or 1, 0 for none */
+    uint8_t len;                /**< prefix length in bits */
+} _nib_lpm_node_t;
+
+static _nib_lpm_node_t _trie[_NIB_LPM_NODES_NUMOF];
+static uint16_t _root;
+
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+static inline _nib_lpm_node_t *_node(uint16_t ref)
+{
+    assert((ref > 0) && (ref <= _NIB_LPM_NODES_NUMOF));
+    return &_trie[ref - 1];
+}
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    assert(pos < IPV6_ADDR_BIT_LEN);
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 1;
+}
+
+static inline bool _node_unused(const _nib_lpm_node_t *node)
+{
+    /* used nodes have an entry or two children */
+    return (node->entry == NULL) && (node->child[0] == 0) &&
+           (node->child[1] == 0);
+}
+
+static uint16_t _node_alloc(uint8_t len, _nib_offl_entry_t *entry)
+{
+    for (unsigned i = 0; i < _NIB_LPM_NODES_NUMOF; i++) {
+        if (_node_unused(&_trie[i])) {
+            _trie[i].len = len;
+            _trie[i].entry = entry;
+            return i + 1;
+        }
+    }
+    /* can't happen with _NIB_LPM_NODES_NUMOF nodes */
+    assert(false);
+    return 0;
+}
+
+static inline void _node_free(_nib_lpm_node_t *node)
+{
+    memset(node, 0, sizeof(*node));
+}
+
+/* prefix shared by all entries below node */
+static const ipv6_addr_t *_node_pfx(const _nib_lpm_node_t *node)
+{
+    while (node->entry == NULL) {
+        node = _node(node->child[0]);
+    }
+    return &node->entry->pfx;
+}
+
+void _nib_lpm_init(void)
+{
+    memset(_trie, 0, sizeof(_trie));
+    _root = 0;
+}
+
+void _nib_lpm_add(_nib_offl_entry_t *offl)
+{
+    const ipv6_addr_t *pfx = &offl->pfx;
+    uint8_t pfx_len = offl->pfx_len;
+    uint16_t *link = &_root;
+
+    assert((offl != NULL) && (pfx_len > 0));
+    DEBUG("nib: add %s/%u to LPM trie\n",
+          ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), pfx_len);
+    while (*link) {
+        _nib_lpm_node_t *node = _node(*link);
+        const ipv6_addr_t *node_pfx = _node_pfx(node);
+        uint8_t common = ipv6_addr_match_prefix(node_pfx, pfx);
+
+        if (common > pfx_len) {
+            common = pfx_len;
+        }
+        if (common < node->len) {
+            /* prefix branches off above node */
+            uint16_t upper;
+
+            if (common == pfx_len) {
+                /* new entry becomes node's parent */
+                upper = _node_alloc(pfx_len, offl);
+            }
+            else {
+                /* allocate leaf first, the branching node counts as unused
+                 * until it has children */
+                uint16_t leaf = _node_alloc(pfx_len, offl);
+
+                upper = _node_alloc(common, NULL);
+                _node(upper)->child[_bit(pfx, common)] = leaf;
+            }
+            _node(upper)->child[_bit(node_pfx, common)] = *link;
+            *link = upper;
+            return;
+        }
+        if (node->len == pfx_len) {
+            /* keep the first of entries with the same prefix */
+            if ((node->entry == NULL) || (offl < node->entry)) {
+                node->entry = offl;
+            }
+            return;
+        }
+        link = &node->child[_bit(pfx, node->len)];
+    }
+    *link = _node_alloc(pfx_len, offl);
+}
+
+static _nib_offl_entry_t *_find_same_pfx(const _nib_offl_entry_t *offl)
+{
+    _nib_offl_entry_t *entry = NULL;
+
+    while ((entry = _nib_offl_iter(entry))) {
+        if ((entry != offl) && (entry->next_hop != NULL) &&
+            (entry->pfx_len == offl->pfx_len) &&
+            (ipv6_addr_match_prefix(&entry->pfx, &offl->pfx) >= offl->pfx_len)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void _nib_lpm_remove(const _nib_offl_entry_t *offl)
+{
+    uint16_t *link = &_root, *parent_link = NULL;
+    _nib_lpm_node_t *node;
+
+    while (*link && (_node(*link)->len < offl->pfx_len)) {
+        parent_link = link;
+        link = &_node(*link)->child[_bit(&offl->pfx, _node(*link)->len)];
+    }
+    if ((*link == 0) || ((node = _node(*link))->entry != offl)) {
+        /* not indexed, e.g. a later entry with the same prefix */
+        return;
+    }
+    DEBUG("nib: remove %s/%u from LPM trie\n",
+          ipv6_addr_to_str(addr_str, &offl->pfx, sizeof(addr_str)),
+          offl->pfx_len);
+    if ((node->entry = _find_same_pfx(offl)) != NULL) {
+        return;
+    }
+    if (node->child[0] && node->child[1]) {
+        /* still needed for branching */
+        return;
+    }
+    /* replace node by its only child, if any */
+    uint16_t child = node->child[0] | node->child[1];
+
+    _node_free(node);
+    *link = child;
+    if ((child == 0) && (parent_link != NULL)) {
+        _nib_lpm_node_t *parent = _node(*parent_link);
+
+        if (parent->entry == NULL) {
+            /* parent is left with a single child, so it is not needed for
+             * branching anymore */
+            child = parent->child[0] | parent->child[1];
+            _node_free(parent);
+            *parent_link = child;
+        }
+    }
+}
+
+_nib_offl_entry_t *_nib_lpm_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    uint16_t ref = _root;
+
+    DEBUG("nib: get match for destination %s from LPM trie\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    while (ref) {
+        const _nib_lpm_node_t *node = _node(ref);
+
+        if (node->entry != NULL) {
+            if (ipv6_addr_match_prefix(&node->entry->pfx, dst) < node->len) {
+                /* no node below can match either */
+                break;
+            }
+            if (node->entry->mode != _EMPTY) {
+                res = node->entry;
+            }
+        }
+        if (node->len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        ref = node->child[_bit(dst, node->len)];
+    }
+    DEBUG("nib: best match %s/%u\n",
+          (res) ? ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)) : "-",
+          (res) ? res->pfx_len : 0);
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @brief
+ * @{
+ *
+ * @file
+ * @brief   Definitions related to the longest-prefix match index of the
+ *          off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ * @internal
+ */
+#ifndef PRIV_NIB_LPM_H
+#define PRIV_NIB_LPM_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Number of trie nodes
+ *
+ * A path-compressed binary trie over `n` distinct prefixes has at most
+ * `2n - 1` nodes.
+ */
+#define _NIB_LPM_NODES_NUMOF    (2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)
+
+/**
+ * @brief   Clears the index
+ *
+ * @note    Only needed to reset the NIB in tests, the index is valid when
+ *          zero-initialized.
+ */
+void _nib_lpm_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the index
+ *
+ * @pre     `(offl != NULL) && (offl->pfx_len > 0)`
+ * @pre     _nib_offl_entry_t::pfx of @p offl is not changed until
+ *          @p offl is removed with @ref _nib_lpm_remove().
+ *
+ * @param[in] offl  A newly allocated off-link entry.
+ */
+void _nib_lpm_add(_nib_offl_entry_t *offl);
+
+/**
+ * @brief   Removes an off-link entry from the index
+ *
+ * @param[in] offl  An off-link entry about to be cleared.
+ */
+void _nib_lpm_remove(const _nib_offl_entry_t *offl);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * Of multiple entries with the same prefix, the first one in the off-link
+ * entry array is returned.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The best matching off-link entry, NULL if there is none.
+ */
+_nib_offl_entry_t *_nib_lpm_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+#define _nib_lpm_init()                 (void)0
+#define _nib_lpm_add(offl)              (void)offl
+#define _nib_lpm_remove(offl)           (void)offl
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_LPM_H */
+/** @} */
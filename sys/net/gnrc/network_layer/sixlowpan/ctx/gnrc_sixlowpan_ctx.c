@@ -17,6 +17,7 @@
 
 #include "mutex.h"
 #include "net/gnrc/sixlowpan/ctx.h"
+#include "net/gnrc/sixlowpan/iphc.h"
 #if IS_USED(MODULE_ZTIMER_MSEC)
 #include "ztimer.h"
 #include "timex.h"
@@ -131,6 +132,7 @@ gnrc_sixlowpan_ctx_t *gnrc_sixlowpan_ctx_update(uint8_t id, const ipv6_addr_t *p
     _ctx_inval_times[id] = ltime + _current_minute();
 
     mutex_unlock(&_ctx_mutex);
+    gnrc_sixlowpan_iphc_cache_invalidate();
     return &(_ctxs[id]);
 }
 
@@ -170,6 +172,7 @@ static void _update_lifetime(uint8_t id)
 void gnrc_sixlowpan_ctx_reset(void)
 {
     memset(_ctxs, 0, sizeof(_ctxs));
+    gnrc_sixlowpan_iphc_cache_invalidate();
 }
 #endif
 
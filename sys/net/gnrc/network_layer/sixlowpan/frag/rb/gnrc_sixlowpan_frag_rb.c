@@ -63,6 +63,23 @@ static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+#ifndef RBUF_IDX_SIZE
+/* number of buckets of the reassembly buffer index */
+#define RBUF_IDX_SIZE   (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "reassembly buffer index only supports up to 254 entries");
+
+/* index of the reassembly buffer by link-layer addresses and tag: the first
+ * entry of each bucket and the next entry in the same bucket for each entry,
+ * both as array index + 1, 0 marks the end of a bucket */
+static uint8_t _rbuf_idx[RBUF_IDX_SIZE];
+static uint8_t _rbuf_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+
+/* interval _rbuf_int_get_free() starts searching from */
+static unsigned _rbuf_int_next;
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -84,6 +101,16 @@ static int _rbuf_get(const void *src, size_t src_len,
                      const void *dst, size_t dst_len,
                      size_t size, uint16_t tag,
                      unsigned page);
+/* checks if an entry belongs to the datagram with the given link-layer
+ * addresses and tag */
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               uint16_t tag);
+/* gets the bucket of the reassembly buffer index for a datagram */
+static unsigned _rbuf_idx_hash(const uint8_t *src, size_t src_len,
+                               const uint8_t *dst, size_t dst_len,
+                               uint16_t tag);
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
@@ -188,21 +215,76 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
     const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
     const uint8_t src_len = netif_hdr->src_l2addr_len;
     const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    unsigned idx = _rbuf_idx[_rbuf_idx_hash(src, src_len, dst, dst_len, tag)];
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    while (idx > 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx - 1];
 
-        if ((e->pkt != NULL) && (e->super.tag == tag) &&
-            (e->super.src_len == src_len) &&
-            (e->super.dst_len == dst_len) &&
-            (memcmp(e->super.src, src, src_len) == 0) &&
-            (memcmp(e->super.dst, dst, dst_len) == 0)) {
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag)) {
             return e;
         }
+        idx = _rbuf_idx_next[idx - 1];
     }
     return NULL;
 }
 
+static inline bool _rbuf_match(const gnrc_sixlowpan_frag_rb_t *e,
+                               const void *src, size_t src_len,
+                               const void *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    return (e->pkt != NULL) && (e->super.tag == tag) &&
+           (e->super.src_len == src_len) &&
+           (e->super.dst_len == dst_len) &&
+           (memcmp(e->super.src, src, src_len) == 0) &&
+           (memcmp(e->super.dst, dst, dst_len) == 0);
+}
+
+static unsigned _rbuf_idx_hash(const uint8_t *src, size_t src_len,
+                               const uint8_t *dst, size_t dst_len,
+                               uint16_t tag)
+{
+    /* djb2 over tag and addresses, the datagram size is not part of the
+     * hash as not all SFR fragments carry it */
+    uint32_t hash = 5381 * 33 + tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) + src[i];
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash * 33) + dst[i];
+    }
+    return hash % RBUF_IDX_SIZE;
+}
+
+static void _rbuf_idx_add(gnrc_sixlowpan_frag_rb_t *e)
+{
+    unsigned hash = _rbuf_idx_hash(e->super.src, e->super.src_len,
+                                   e->super.dst, e->super.dst_len,
+                                   e->super.tag);
+
+    _rbuf_idx_next[e - rbuf] = _rbuf_idx[hash];
+    _rbuf_idx[hash] = (e - rbuf) + 1;
+}
+
+static void _rbuf_idx_rm(gnrc_sixlowpan_frag_rb_t *e)
+{
+    uint8_t *idx = &_rbuf_idx[_rbuf_idx_hash(e->super.src, e->super.src_len,
+                                             e->super.dst, e->super.dst_len,
+                                             e->super.tag)];
+
+    /* entries are only in the index while in use, so it might not be found
+     * when removed twice */
+    while (*idx > 0) {
+        if (*idx == (e - rbuf) + 1) {
+            *idx = _rbuf_idx_next[e - rbuf];
+            _rbuf_idx_next[e - rbuf] = 0;
+            return;
+        }
+        idx = &_rbuf_idx_next[*idx - 1];
+    }
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -291,6 +373,25 @@ static gnrc_pktsnip_t *_mark_frag_hdr(gnrc_pktsnip_t *pkt)
     return NULL;
 }
 
+/* the reassembly buffer and the VRB are collected when a new datagram needs
+ * an entry, a timed out VRB entry hit by a subsequent fragment is evicted
+ * right away */
+static gnrc_sixlowpan_frag_vrb_t *_vrb_get(const uint8_t *src, size_t src_len,
+                                           unsigned tag)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(src, src_len,
+                                                                  tag);
+
+    if ((vrbe != NULL) &&
+        ((xtimer_now_usec() - vrbe->super.arrival) >
+         CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+        DEBUG("6lo rbuf minfwd: VRB entry timed out\n");
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        vrbe = NULL;
+    }
+    return vrbe;
+}
+
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page)
 {
@@ -338,14 +439,13 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    gnrc_sixlowpan_frag_rb_gc();
     /* only check VRB for subsequent frags, first frags create and not get VRB
      * entries below */
     if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) &&
         (offset > 0) &&
         sixlowpan_frag_n_is(pkt->data) &&
-        (entry.vrb = gnrc_sixlowpan_frag_vrb_get(src, netif_hdr->src_l2addr_len,
-                                                 datagram_tag)) != NULL) {
+        (entry.vrb = _vrb_get(src, netif_hdr->src_l2addr_len,
+                              datagram_tag)) != NULL) {
         DEBUG("6lo rbuf minfwd: VRB entry found, trying to forward\n");
         switch (_check_fragments(entry.super, frag_size, offset)) {
             case RBUF_ADD_REPEAT:
@@ -514,7 +614,12 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
 
 static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
+    /* intervals are mostly freed in the order they were taken, so continue
+     * after the last one taken */
+    for (unsigned int n = 0; n < RBUF_INT_SIZE; n++) {
+        unsigned int i = _rbuf_int_next;
+
+        _rbuf_int_next = (_rbuf_int_next + 1) % RBUF_INT_SIZE;
         if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
             return rbuf_int + i;
         }
@@ -577,9 +682,9 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
     gnrc_pktbuf_release(rbuf->pkt);
 }
 
-void gnrc_sixlowpan_frag_rb_gc(void)
+/* collects garbage in the reassembly buffer, but not in the VRB */
+static void _rbuf_gc(uint32_t now_usec)
 {
-    uint32_t now_usec = xtimer_now_usec();
     unsigned int i;
 
     for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
@@ -601,6 +706,11 @@ void gnrc_sixlowpan_frag_rb_gc(void)
             gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
         }
     }
+}
+
+void gnrc_sixlowpan_frag_rb_gc(void)
+{
+    _rbuf_gc(xtimer_now_usec());
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
 #endif
@@ -619,42 +729,56 @@ static int _rbuf_get(const void *src, size_t src_len,
 {
     gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
     uint32_t now_usec = xtimer_now_usec();
+    unsigned idx = _rbuf_idx[_rbuf_idx_hash(src, src_len, dst, dst_len, tag)];
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
+    /* check first if entry already available */
+    while (idx > 0) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[idx - 1];
+
+        idx = _rbuf_idx_next[idx - 1];
+        if (_rbuf_match(e, src, src_len, dst, dst_len, tag) &&
             ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
               /* not all SFR fragments carry the datagram size, so make 0 a
                * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
+              ((size == 0) || (e->super.datagram_size == size))) ||
              (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+              (e->super.datagram_size == size)))) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)e,
+                  gnrc_netif_addr_to_str(e->super.src,
+                                         e->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(e->super.dst,
+                                         e->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+                  (unsigned)e->super.datagram_size, e->super.tag);
+            if ((now_usec - e->super.arrival) >
+                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US) {
+                /* garbage collection is only done for new datagrams, so
+                 * collect the timed out entry before it is extended */
+                DEBUG("6lo rfrag: entry timed out, starting new one\n");
+                _gc_pkt(e);
+                gnrc_sixlowpan_frag_rb_remove(e);
+                break;
+            }
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
+            if (e->super.current_size == 0) {
                 /* ensure that only empty reassembly buffer entries and entries
                  * scheduled for deletion have `current_size == 0` */
                 DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
                 return -1;
             }
 #endif
-            rbuf[i].super.arrival = now_usec;
+            e->super.arrival = now_usec;
             _set_rbuf_timeout();
-            return i;
+            return e - rbuf;
         }
+    }
+
+    /* since pkt occupies pktbuf, collect garbage before taking a new entry */
+    _rbuf_gc(now_usec);
 
+    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         /* if there is a free spot: remember it */
         if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
             res = &(rbuf[i]);
@@ -746,6 +870,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+    _rbuf_idx_add(res);
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +897,9 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_idx, 0, sizeof(_rbuf_idx));
+    memset(_rbuf_idx_next, 0, sizeof(_rbuf_idx_next));
+    _rbuf_int_next = 0;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -780,6 +908,14 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 }
 #endif
 
+void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
+{
+    assert(rbuf != NULL);
+    _rbuf_idx_rm(rbuf);
+    gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
+    rbuf->pkt = NULL;
+}
+
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
     while (entry->ints != NULL) {
@@ -13,6 +13,8 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <assert.h>
+
 #include "net/ieee802154.h"
 #ifdef MODULE_GNRC_IPV6_NIB
 #include "net/ipv6/addr.h"
@@ -31,6 +33,20 @@
 #include "debug.h"
 
 static gnrc_sixlowpan_frag_vrb_t _vrb[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
+
+#ifndef VRB_IDX_SIZE
+/* number of buckets of the VRB index */
+#define VRB_IDX_SIZE    (CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE)
+#endif
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE < UINT8_MAX,
+              "VRB index only supports up to 254 entries");
+
+/* index of the VRB by link-layer source address and tag: the first entry of
+ * each bucket and the next entry in the same bucket for each entry, both as
+ * array index + 1, 0 marks the end of a bucket */
+static uint8_t _vrb_idx[VRB_IDX_SIZE];
+static uint8_t _vrb_idx_next[CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE];
 #ifdef MODULE_GNRC_IPV6_NIB
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #else   /* MODULE_GNRC_IPV6_NIB */
@@ -46,70 +62,121 @@ static inline bool _equal_index(const gnrc_sixlowpan_frag_vrb_t *vrbe,
             (memcmp(vrbe->super.src, src, src_len) == 0));
 }
 
+static unsigned _idx_hash(const uint8_t *src, size_t src_len, unsigned tag)
+{
+    /* djb2 over tag and source address */
+    uint32_t hash = 5381 * 33 + (uint16_t)tag;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash * 33) + src[i];
+    }
+    return hash % VRB_IDX_SIZE;
+}
+
+static gnrc_sixlowpan_frag_vrb_t *_idx_get(const uint8_t *src, size_t src_len,
+                                           unsigned tag)
+{
+    unsigned idx = _vrb_idx[_idx_hash(src, src_len, tag)];
+
+    while (idx > 0) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[idx - 1];
+
+        if (_equal_index(vrbe, src, src_len, tag)) {
+            return vrbe;
+        }
+        idx = _vrb_idx_next[idx - 1];
+    }
+    return NULL;
+}
+
+static void _idx_add(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    unsigned hash = _idx_hash(vrbe->super.src, vrbe->super.src_len,
+                              vrbe->super.tag);
+
+    _vrb_idx_next[vrbe - _vrb] = _vrb_idx[hash];
+    _vrb_idx[hash] = (vrbe - _vrb) + 1;
+}
+
+static void _idx_rm(gnrc_sixlowpan_frag_vrb_t *vrbe)
+{
+    uint8_t *idx = &_vrb_idx[_idx_hash(vrbe->super.src, vrbe->super.src_len,
+                                       vrbe->super.tag)];
+
+    while (*idx > 0) {
+        if (*idx == (vrbe - _vrb) + 1) {
+            *idx = _vrb_idx_next[vrbe - _vrb];
+            _vrb_idx_next[vrbe - _vrb] = 0;
+            return;
+        }
+        idx = &_vrb_idx_next[*idx - 1];
+    }
+}
+
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
         const gnrc_sixlowpan_frag_rb_base_t *base,
         gnrc_netif_t *out_netif, const uint8_t *out_dst, size_t out_dst_len)
 {
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
 
     assert(base != NULL);
     assert(base->src_len != 0);
     assert(out_netif != NULL);
     assert(out_dst != NULL);
     assert(out_dst_len > 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *ptr = &_vrb[i];
-
-        if (gnrc_sixlowpan_frag_vrb_entry_empty(ptr) ||
-            _equal_index(ptr, base->src, base->src_len, base->tag)) {
-            vrbe = ptr;
-            if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
-                vrbe->super = *base;
-                vrbe->out_netif = out_netif;
-                memcpy(vrbe->super.dst, out_dst, out_dst_len);
-                vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
-                vrbe->super.dst_len = out_dst_len;
-                DEBUG("6lo vrb: creating entry (%s, ",
-                      gnrc_netif_addr_to_str(vrbe->super.src,
-                                             vrbe->super.src_len,
-                                             addr_str));
-                DEBUG("%s, %u, %u) => ",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str),
-                      (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
-                DEBUG("(%s, %u)\n",
-                      gnrc_netif_addr_to_str(vrbe->super.dst,
-                                             vrbe->super.dst_len,
-                                             addr_str), vrbe->out_tag);
-            }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
+    vrbe = _idx_get(base->src, base->src_len, base->tag);
+    for (unsigned i = 0; (vrbe == NULL) && (i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE); i++) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(&_vrb[i])) {
+            vrbe = &_vrb[i];
+        }
+    }
+    if (vrbe != NULL) {
+        if (gnrc_sixlowpan_frag_vrb_entry_empty(vrbe)) {
+            vrbe->super = *base;
+            vrbe->out_netif = out_netif;
+            memcpy(vrbe->super.dst, out_dst, out_dst_len);
+            vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+            vrbe->super.dst_len = out_dst_len;
+            DEBUG("6lo vrb: creating entry (%s, ",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str));
+            DEBUG("%s, %u, %u) => ",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str),
+                  (unsigned)vrbe->super.datagram_size, vrbe->super.tag);
+            DEBUG("(%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.dst,
+                                         vrbe->super.dst_len,
+                                         addr_str), vrbe->out_tag);
+            _idx_add(vrbe);
+        }
+        /* _equal_index() => append intervals of `base`, so they don't get
+         * lost. We use append, so we don't need to change base! */
+        else if (base->ints != NULL) {
+            gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
 
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
+            if (tmp != base->ints) {
+                /* base->ints is not already vrbe->super.ints */
+                if (tmp != NULL) {
+                    /* iterate before appending and check if `base->ints` is
+                     * not already part of list */
+                    while (tmp->next != NULL) {
+                        if (tmp == base->ints) {
+                            tmp = NULL;
+                            break;
                         }
+                        tmp = tmp->next;
                     }
-                    else {
-                        vrbe->super.ints = base->ints;
+                    if (tmp != NULL) {
+                        tmp->next = base->ints;
                     }
                 }
+                else {
+                    vrbe->super.ints = base->ints;
+                }
             }
-            break;
         }
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
@@ -128,6 +195,9 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_from_route(
 
     assert(base != NULL);
     assert((hdr != NULL) && (hdr->data != NULL) && (hdr->size > 0));
+    /* a new datagram is about to be forwarded: make room by removing
+     * timed out entries */
+    gnrc_sixlowpan_frag_vrb_gc();
     switch (hdr->type) {
 #ifdef MODULE_GNRC_IPV6_NIB
         case GNRC_NETTYPE_IPV6: {
@@ -170,16 +240,14 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     DEBUG("6lo vrb: trying to get entry for (%s, %u)\n",
           gnrc_netif_addr_to_str(src, src_len, addr_str), src_tag);
     assert(src_len != 0);
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
-        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+    gnrc_sixlowpan_frag_vrb_t *vrbe = _idx_get(src, src_len, src_tag);
 
-        if (_equal_index(vrbe, src, src_len, src_tag)) {
-            DEBUG("6lo vrb: got VRB to (%s, %u)\n",
-                  gnrc_netif_addr_to_str(vrbe->super.dst,
-                                         vrbe->super.dst_len,
-                                         addr_str), vrbe->out_tag);
-            return vrbe;
-        }
+    if (vrbe != NULL) {
+        DEBUG("6lo vrb: got VRB to (%s, %u)\n",
+              gnrc_netif_addr_to_str(vrbe->super.dst,
+                                     vrbe->super.dst_len,
+                                     addr_str), vrbe->out_tag);
+        return vrbe;
     }
     DEBUG("6lo vrb: no entry found\n");
     return NULL;
@@ -209,6 +277,18 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
 
 }
 
+void gnrc_sixlowpan_frag_vrb_rm(gnrc_sixlowpan_frag_vrb_t *vrb)
+{
+    if (gnrc_sixlowpan_frag_vrb_entry_empty(vrb)) {
+        return;
+    }
+    _idx_rm(vrb);
+    if (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_RB)) {
+        gnrc_sixlowpan_frag_rb_base_rm(&vrb->super);
+    }
+    vrb->super.src_len = 0;
+}
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
@@ -234,6 +314,8 @@ void gnrc_sixlowpan_frag_vrb_gc(void)
 void gnrc_sixlowpan_frag_vrb_reset(void)
 {
     memset(_vrb, 0, sizeof(_vrb));
+    memset(_vrb_idx, 0, sizeof(_vrb_idx));
+    memset(_vrb_idx_next, 0, sizeof(_vrb_idx_next));
 }
 #endif
 
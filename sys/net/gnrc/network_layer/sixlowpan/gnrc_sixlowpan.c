@@ -19,6 +19,7 @@
 #include "thread.h"
 #include "utlist.h"
 
+#include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
@@ -80,6 +81,11 @@ void gnrc_sixlowpan_dispatch_recv(gnrc_pktsnip_t *pkt, void *context,
 #else   /* MODULE_GNRC_IPV6 */
     /* just assume normal IPv6 traffic */
     type = GNRC_NETTYPE_IPV6;
+#if IS_USED(MODULE_GNRC_RX_FASTPATH)
+    if (gnrc_ipv6_receive_fastpath(pkt)) {
+        return;
+    }
+#endif
 #endif  /* MODULE_GNRC_IPV6 */
     if (!gnrc_netapi_dispatch_receive(type,
                                       GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
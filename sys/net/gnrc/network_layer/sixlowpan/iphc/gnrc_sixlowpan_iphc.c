@@ -18,6 +18,7 @@
 
 #include <stdbool.h>
 
+#include "atomic_utils.h"
 #include "byteorder.h"
 #include "net/ipv6/hdr.h"
 #include "net/ipv6/ext.h"
@@ -1073,27 +1074,31 @@ static inline bool _compressible_nh(uint8_t nh)
     }
 }
 
-static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
-                                const gnrc_netif_hdr_t *netif_hdr,
-                                gnrc_netif_t *iface,
-                                uint8_t *iphc_hdr)
+/* address part of an IPHC header: it only depends on the addresses, the
+ * interface and the link-layer destination of a packet */
+typedef struct {
+    uint8_t iphc2;      /* SAC, SAM, M, DAC and DAM of the second IPHC byte */
+    uint8_t cid;        /* context identifier extension, elided if 0 */
+    uint8_t ctx;        /* contexts used, see ADDR_CTX_SRC and ADDR_CTX_DST */
+    uint8_t len;        /* length of inline_addr */
+    uint8_t inline_addr[2 * sizeof(ipv6_addr_t)];   /* inline addresses */
+} _iphc_addr_t;
+
+#define ADDR_CTX_SRC                (0x01)
+#define ADDR_CTX_DST                (0x02)
+
+static bool _iphc_addr_encode(ipv6_hdr_t *ipv6_hdr,
+                              const gnrc_netif_hdr_t *netif_hdr,
+                              gnrc_netif_t *iface,
+                              _iphc_addr_t *addr)
 {
     gnrc_sixlowpan_ctx_t *src_ctx = NULL, *dst_ctx = NULL;
-    ipv6_hdr_t *ipv6_hdr;
+    uint8_t *inline_addr = addr->inline_addr;
     bool addr_comp = false;
-    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
-
-    assert(iface != NULL);
 
-    if (pkt->next == NULL) {
-        DEBUG("6lo iphc: packet missing header\n");
-        return 0;
-    }
-    ipv6_hdr = pkt->next->data;
-
-    /* set initial dispatch value*/
-    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
-    iphc_hdr[IPHC2_IDX] = 0;
+    addr->iphc2 = 0;
+    addr->cid = 0;
+    addr->ctx = 0;
 
     /* check for available contexts */
     if (!ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
@@ -1124,90 +1129,15 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
         }
     }
 
-    /* if contexts available and both != 0 */
-    /* since this moves inline_pos we have to do this ahead*/
-    if (((src_ctx != NULL) &&
-            ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) ||
-        ((dst_ctx != NULL) &&
-            ((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0))) {
-        /* add context identifier extension */
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
-        iphc_hdr[CID_EXT_IDX] = 0;
-
-        /* move position to behind CID extension */
-        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
-    }
-
-    /* compress flow label and traffic class */
-    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
-        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
-            /* elide both traffic class and flow label */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
-        }
-        else {
-            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-        }
-    }
-    else {
-        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
-            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
-                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
-        }
-        else {
-            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
-            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
-            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
-            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
-        }
-
-        /* copy remaining bytes of flow label */
-        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
-        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
-    }
-
-    /* check for compressible next header */
-    if (_compressible_nh(ipv6_hdr->nh)) {
-        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
-    }
-    else {
-        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
-    }
-
-    /* compress hop limit */
-    switch (ipv6_hdr->hl) {
-        case 1:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
-            break;
-
-        case 64:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
-            break;
-
-        case 255:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
-            break;
-
-        default:
-            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
-            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
-            break;
-    }
-
     if (ipv6_addr_is_unspecified(&(ipv6_hdr->src))) {
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_UNSPEC;
+        addr->iphc2 |= IPHC_SAC_SAM_UNSPEC;
     }
     else {
         if (src_ctx != NULL) {
             /* stateful source address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_SAC;
-
-            if (((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
-            }
+            addr->iphc2 |= SIXLOWPAN_IPHC2_SAC;
+            addr->cid |= ((src_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) << 4);
+            addr->ctx |= ADDR_CTX_SRC;
         }
 
         if ((src_ctx != NULL) || ipv6_addr_is_link_local(&(ipv6_hdr->src))) {
@@ -1218,38 +1148,38 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
             if (gnrc_netif_ipv6_get_iid(iface, &iid) < 0) {
                 DEBUG("6lo iphc: could not get interface's IID\n");
                 gnrc_netif_release(iface);
-                return 0;
+                return false;
             }
             gnrc_netif_release(iface);
 
             if ((ipv6_hdr->src.u64[1].u64 == iid.uint64.u64) ||
                 _context_overlaps_iid(src_ctx, &ipv6_hdr->src, &iid)) {
                 /* 0 bits. The address is derived from link-layer address */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_L2;
+                addr->iphc2 |= IPHC_SAC_SAM_L2;
                 addr_comp = true;
             }
             else if ((byteorder_ntohl(ipv6_hdr->src.u32[2]) == 0x000000ff) &&
                      (byteorder_ntohs(ipv6_hdr->src.u16[6]) == 0xfe00)) {
                 /* 16 bits. The address is derived using 16 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_16;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u16 + 7, 2);
-                inline_pos += 2;
+                addr->iphc2 |= IPHC_SAC_SAM_16;
+                memcpy(inline_addr, ipv6_hdr->src.u16 + 7, 2);
+                inline_addr += 2;
                 addr_comp = true;
             }
             else {
                 /* 64 bits. The address is derived using 64 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_64;
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->src.u64 + 1, 8);
-                inline_pos += 8;
+                addr->iphc2 |= IPHC_SAC_SAM_64;
+                memcpy(inline_addr, ipv6_hdr->src.u64 + 1, 8);
+                inline_addr += 8;
                 addr_comp = true;
             }
         }
 
         if (!addr_comp) {
             /* full address is carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-            memcpy(iphc_hdr + inline_pos, &ipv6_hdr->src, 16);
-            inline_pos += 16;
+            addr->iphc2 |= IPHC_SAC_SAM_FULL;
+            memcpy(inline_addr, &ipv6_hdr->src, 16);
+            inline_addr += 16;
         }
     }
 
@@ -1257,7 +1187,7 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 
     /* M: Multicast compression */
     if (ipv6_addr_is_multicast(&(ipv6_hdr->dst))) {
-        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_M;
+        addr->iphc2 |= SIXLOWPAN_IPHC2_M;
 
         /* if multicast address is of format ffXX::XXXX:XXXX:XXXX */
         if ((ipv6_hdr->dst.u16[1].u16 == 0) &&
@@ -1269,27 +1199,27 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                 (ipv6_hdr->dst.u16[6].u16 == 0) &&
                 (ipv6_hdr->dst.u8[14] == 0)) {
                 /* 8 bits. The address is derived using 8 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_8;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[15];
+                addr->iphc2 |= IPHC_M_DAC_DAM_M_8;
+                *(inline_addr++) = ipv6_hdr->dst.u8[15];
                 addr_comp = true;
             }
             /* if multicast address is of format ffXX::XX:XXXX */
             else if ((ipv6_hdr->dst.u16[5].u16 == 0) &&
                      (ipv6_hdr->dst.u8[12] == 0)) {
                 /* 32 bits. The address is derived using 32 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_32;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 13, 3);
-                inline_pos += 3;
+                addr->iphc2 |= IPHC_M_DAC_DAM_M_32;
+                *(inline_addr++) = ipv6_hdr->dst.u8[1];
+                memcpy(inline_addr, ipv6_hdr->dst.u8 + 13, 3);
+                inline_addr += 3;
                 addr_comp = true;
             }
             /* if multicast address is of format ffXX::XX:XXXX:XXXX */
             else if (ipv6_hdr->dst.u8[10] == 0) {
                 /* 48 bits. The address is derived using 48 bits carried inline */
-                iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_M_48;
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u8 + 11, 5);
-                inline_pos += 5;
+                addr->iphc2 |= IPHC_M_DAC_DAM_M_48;
+                *(inline_addr++) = ipv6_hdr->dst.u8[1];
+                memcpy(inline_addr, ipv6_hdr->dst.u8 + 11, 5);
+                inline_addr += 5;
                 addr_comp = true;
             }
         }
@@ -1309,14 +1239,13 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
                 /* Unicast prefix based IPv6 multicast address
                  * (https://tools.ietf.org/html/rfc3306) with given context
                  * for unicast prefix -> context based compression */
-                iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
-                if ((ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0) {
-                    iphc_hdr[CID_EXT_IDX] |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
-                }
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[1];
-                iphc_hdr[inline_pos++] = ipv6_hdr->dst.u8[2];
-                memcpy(iphc_hdr + inline_pos, ipv6_hdr->dst.u16 + 6, 4);
-                inline_pos += 4;
+                addr->iphc2 |= SIXLOWPAN_IPHC2_DAC;
+                addr->cid |= (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+                addr->ctx |= ADDR_CTX_DST;
+                *(inline_addr++) = ipv6_hdr->dst.u8[1];
+                *(inline_addr++) = ipv6_hdr->dst.u8[2];
+                memcpy(inline_addr, ipv6_hdr->dst.u16 + 6, 4);
+                inline_addr += 4;
                 addr_comp = true;
             }
         }
@@ -1327,47 +1256,246 @@ static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
 
         if (dst_ctx != NULL) {
             /* stateful destination address compression */
-            iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_DAC;
-
-            if (((dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK) != 0)) {
-                iphc_hdr[CID_EXT_IDX] |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
-            }
+            addr->iphc2 |= SIXLOWPAN_IPHC2_DAC;
+            addr->cid |= (dst_ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK);
+            addr->ctx |= ADDR_CTX_DST;
         }
 
         if (gnrc_netif_hdr_ipv6_iid_from_dst(iface, netif_hdr, &iid) < 0) {
             DEBUG("6lo iphc: could not get destination's IID\n");
-            return 0;
+            return false;
         }
 
         if ((ipv6_hdr->dst.u64[1].u64 == iid.uint64.u64) ||
             _context_overlaps_iid(dst_ctx, &(ipv6_hdr->dst), &iid)) {
             /* 0 bits. The address is derived using the link-layer address */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_L2;
+            addr->iphc2 |= IPHC_M_DAC_DAM_U_L2;
             addr_comp = true;
         }
         else if ((byteorder_ntohl(ipv6_hdr->dst.u32[2]) == 0x000000ff) &&
                  (byteorder_ntohs(ipv6_hdr->dst.u16[6]) == 0xfe00)) {
             /* 16 bits. The address is derived using 16 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_16;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u16[7]), 2);
-            inline_pos += 2;
+            addr->iphc2 |= IPHC_M_DAC_DAM_U_16;
+            memcpy(inline_addr, &(ipv6_hdr->dst.u16[7]), 2);
+            inline_addr += 2;
             addr_comp = true;
         }
         else {
             /* 64 bits. The address is derived using 64 bits carried inline */
-            iphc_hdr[IPHC2_IDX] |= IPHC_M_DAC_DAM_U_64;
-            memcpy(&(iphc_hdr[inline_pos]), &(ipv6_hdr->dst.u8[8]), 8);
-            inline_pos += 8;
+            addr->iphc2 |= IPHC_M_DAC_DAM_U_64;
+            memcpy(inline_addr, &(ipv6_hdr->dst.u8[8]), 8);
+            inline_addr += 8;
             addr_comp = true;
         }
     }
 
     if (!addr_comp) {
         /* full destination address is carried inline */
-        iphc_hdr[IPHC2_IDX] |= IPHC_SAC_SAM_FULL;
-        memcpy(iphc_hdr + inline_pos, &ipv6_hdr->dst, 16);
-        inline_pos += 16;
+        addr->iphc2 |= IPHC_SAC_SAM_FULL;
+        memcpy(inline_addr, &ipv6_hdr->dst, 16);
+        inline_addr += 16;
+    }
+
+    addr->len = inline_addr - addr->inline_addr;
+    return true;
+}
+
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC_CACHE)
+typedef struct {
+    gnrc_netif_t *iface;                /* NULL if the entry is unused */
+    ipv6_addr_t src;
+    ipv6_addr_t dst;
+    uint16_t gen;                       /* _cache_gen when the entry was filled */
+    uint8_t dst_l2addr_len;
+    uint8_t dst_l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    _iphc_addr_t addr;
+} _iphc_cache_t;
+
+/* entries are only accessed from the 6LoWPAN thread, invalidation may happen
+ * from any thread and is thus done by bumping the generation */
+static _iphc_cache_t _cache[CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE];
+static unsigned _cache_next;
+static uint16_t _cache_gen;
+
+void gnrc_sixlowpan_iphc_cache_invalidate(void)
+{
+    atomic_fetch_add_u16(&_cache_gen, 1);
+}
+
+static bool _cache_ctx_valid(uint8_t id)
+{
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_lookup_id(id);
+
+    return (ctx != NULL) && (ctx->flags_id & GNRC_SIXLOWPAN_CTX_FLAGS_COMP);
+}
+
+static bool _cache_match(const _iphc_cache_t *entry, const ipv6_hdr_t *ipv6_hdr,
+                         const gnrc_netif_hdr_t *netif_hdr,
+                         const gnrc_netif_t *iface, uint16_t gen)
+{
+    if ((entry->iface != iface) || (entry->gen != gen) ||
+        !ipv6_addr_equal(&entry->dst, &ipv6_hdr->dst) ||
+        !ipv6_addr_equal(&entry->src, &ipv6_hdr->src) ||
+        (entry->dst_l2addr_len != netif_hdr->dst_l2addr_len) ||
+        (memcmp(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                entry->dst_l2addr_len) != 0)) {
+        return false;
     }
+    /* the compression flag of a context is removed when its lifetime
+     * expires, which is only noticed on lookup */
+    if ((entry->addr.ctx & ADDR_CTX_SRC) &&
+        !_cache_ctx_valid(entry->addr.cid >> 4)) {
+        return false;
+    }
+    if ((entry->addr.ctx & ADDR_CTX_DST) &&
+        !_cache_ctx_valid(entry->addr.cid & GNRC_SIXLOWPAN_CTX_FLAGS_CID_MASK)) {
+        return false;
+    }
+    return true;
+}
+
+static const _iphc_addr_t *_iphc_addr_get(ipv6_hdr_t *ipv6_hdr,
+                                          const gnrc_netif_hdr_t *netif_hdr,
+                                          gnrc_netif_t *iface,
+                                          _iphc_addr_t *tmp)
+{
+    uint16_t gen = atomic_load_u16(&_cache_gen);
+    _iphc_cache_t *entry;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE; i++) {
+        if (_cache_match(&_cache[i], ipv6_hdr, netif_hdr, iface, gen)) {
+            DEBUG("6lo iphc: using cached address compression %u\n", i);
+            return &_cache[i].addr;
+        }
+    }
+    if (netif_hdr->dst_l2addr_len > sizeof(entry->dst_l2addr)) {
+        return _iphc_addr_encode(ipv6_hdr, netif_hdr, iface, tmp) ? tmp : NULL;
+    }
+    entry = &_cache[_cache_next];
+    _cache_next = (_cache_next + 1) % CONFIG_GNRC_SIXLOWPAN_IPHC_CACHE_SIZE;
+    if (!_iphc_addr_encode(ipv6_hdr, netif_hdr, iface, &entry->addr)) {
+        entry->iface = NULL;
+        return NULL;
+    }
+    entry->iface = iface;
+    entry->src = ipv6_hdr->src;
+    entry->dst = ipv6_hdr->dst;
+    entry->gen = gen;
+    entry->dst_l2addr_len = netif_hdr->dst_l2addr_len;
+    memcpy(entry->dst_l2addr, gnrc_netif_hdr_get_dst_addr(netif_hdr),
+           netif_hdr->dst_l2addr_len);
+    return &entry->addr;
+}
+#else   /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+static const _iphc_addr_t *_iphc_addr_get(ipv6_hdr_t *ipv6_hdr,
+                                          const gnrc_netif_hdr_t *netif_hdr,
+                                          gnrc_netif_t *iface,
+                                          _iphc_addr_t *tmp)
+{
+    return _iphc_addr_encode(ipv6_hdr, netif_hdr, iface, tmp) ? tmp : NULL;
+}
+#endif  /* MODULE_GNRC_SIXLOWPAN_IPHC_CACHE */
+
+static size_t _iphc_ipv6_encode(gnrc_pktsnip_t *pkt,
+                                const gnrc_netif_hdr_t *netif_hdr,
+                                gnrc_netif_t *iface,
+                                uint8_t *iphc_hdr)
+{
+    const _iphc_addr_t *addr;
+    _iphc_addr_t tmp;
+    ipv6_hdr_t *ipv6_hdr;
+    uint16_t inline_pos = SIXLOWPAN_IPHC_HDR_LEN;
+
+    assert(iface != NULL);
+
+    if (pkt->next == NULL) {
+        DEBUG("6lo iphc: packet missing header\n");
+        return 0;
+    }
+    ipv6_hdr = pkt->next->data;
+
+    /* addresses are carried at the end of the header, but they determine
+     * whether a context identifier extension precedes all other inline
+     * fields */
+    if ((addr = _iphc_addr_get(ipv6_hdr, netif_hdr, iface, &tmp)) == NULL) {
+        return 0;
+    }
+
+    /* set initial dispatch value*/
+    iphc_hdr[IPHC1_IDX] = SIXLOWPAN_IPHC1_DISP;
+    iphc_hdr[IPHC2_IDX] = addr->iphc2;
+
+    /* if a context other than 0 is used */
+    if (addr->cid != 0) {
+        /* add context identifier extension */
+        iphc_hdr[IPHC2_IDX] |= SIXLOWPAN_IPHC2_CID_EXT;
+        iphc_hdr[CID_EXT_IDX] = addr->cid;
+
+        /* move position to behind CID extension */
+        inline_pos += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+
+    /* compress flow label and traffic class */
+    if (ipv6_hdr_get_fl(ipv6_hdr) == 0) {
+        if (ipv6_hdr_get_tc(ipv6_hdr) == 0) {
+            /* elide both traffic class and flow label */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_ELIDE;
+        }
+        else {
+            /* elide flow label, traffic class (ECN + DSCP) inline (1 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+        }
+    }
+    else {
+        if (ipv6_hdr_get_tc_dscp(ipv6_hdr) == 0) {
+            /* elide DSCP, ECN + 2-bit pad + flow label inline (3 byte) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_FL;
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_tc_ecn(ipv6_hdr) << 6) |
+                                               ((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16));
+        }
+        else {
+            /* ECN + DSCP + 4-bit pad + flow label (4 bytes) */
+            iphc_hdr[IPHC1_IDX] |= IPHC_TF_ECN_DSCP_FL;
+            iphc_hdr[inline_pos++] = ipv6_hdr_get_tc(ipv6_hdr);
+            iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x000f0000) >> 16);
+        }
+
+        /* copy remaining bytes of flow label */
+        iphc_hdr[inline_pos++] = (uint8_t)((ipv6_hdr_get_fl(ipv6_hdr) & 0x0000ff00) >> 8);
+        iphc_hdr[inline_pos++] = (uint8_t)(ipv6_hdr_get_fl(ipv6_hdr) & 0x000000ff);
+    }
+
+    /* check for compressible next header */
+    if (_compressible_nh(ipv6_hdr->nh)) {
+        iphc_hdr[IPHC1_IDX] |= SIXLOWPAN_IPHC1_NH;
+    }
+    else {
+        iphc_hdr[inline_pos++] = ipv6_hdr->nh;
+    }
+
+    /* compress hop limit */
+    switch (ipv6_hdr->hl) {
+        case 1:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_1;
+            break;
+
+        case 64:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_64;
+            break;
+
+        case 255:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_255;
+            break;
+
+        default:
+            iphc_hdr[IPHC1_IDX] |= IPHC_HL_INLINE;
+            iphc_hdr[inline_pos++] = ipv6_hdr->hl;
+            break;
+    }
+
+    memcpy(iphc_hdr + inline_pos, addr->inline_addr, addr->len);
+    inline_pos += addr->len;
 
     return inline_pos;
 }
@@ -87,6 +87,9 @@ static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
 #ifdef MODULE_GNRC_NETERR
     pkt->err_sub = KERNEL_PID_UNDEF;
 #endif
+#ifdef MODULE_GNRC_PKTLAT
+    pkt->lat_layer = 0;
+#endif
 }
 
 void gnrc_pktbuf_init(void)
@@ -228,6 +231,10 @@ gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
         new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
         if (new != NULL) {
             pkt->users--;
+#ifdef MODULE_GNRC_PKTLAT
+            new->lat_time = pkt->lat_time;
+            new->lat_layer = pkt->lat_layer;
+#endif
         }
         mutex_unlock(&gnrc_pktbuf_mutex);
         return new;
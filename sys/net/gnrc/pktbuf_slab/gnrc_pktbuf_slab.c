@@ -0,0 +1,505 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer with segregated size classes
+ *
+ * Every size class is an array of equally sized objects with a free list
+ * threaded through the unused objects. An object may be shared by multiple
+ * data sections after @ref gnrc_pktbuf_mark() split it at an aligned offset,
+ * so every object counts the data sections referring to it and is returned to
+ * the free list when the last one is released.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+#include "pktbuf_slab.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _SLAB_ROUND(size)   (((size) + GNRC_PKTBUF_SLAB_ALIGN - 1) & \
+                             ~(GNRC_PKTBUF_SLAB_ALIGN - 1))
+
+#define _SNIP_SIZE          _SLAB_ROUND(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SIZE         _SLAB_ROUND(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _LARGE_SIZE         _SLAB_ROUND(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+static_assert(_SNIP_SIZE <= _SMALL_SIZE,
+              "CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE must fit a gnrc_pktsnip_t");
+static_assert(_SMALL_SIZE <= _LARGE_SIZE,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE must not be smaller than "
+              "CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE");
+static_assert(_LARGE_SIZE <= UINT16_MAX,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE too large");
+
+/**
+ * @brief   Free object, the free list is threaded through them
+ */
+typedef struct _slab_free {
+    struct _slab_free *next;    /**< next free object */
+} _slab_free_t;
+
+/**
+ * @brief   A size class
+ */
+typedef struct {
+    uint8_t *buf;               /**< the objects */
+    uint8_t *refs;              /**< data sections referring to each object */
+    _slab_free_t *free;         /**< first free object */
+    gnrc_pktbuf_slab_stats_t stats; /**< statistics, also holds size and
+                                     *   number of the objects */
+} _slab_t;
+
+static alignas(GNRC_PKTBUF_SLAB_ALIGN)
+uint8_t _snip_buf[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF * _SNIP_SIZE];
+static alignas(GNRC_PKTBUF_SLAB_ALIGN)
+uint8_t _small_buf[CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF * _SMALL_SIZE];
+static alignas(GNRC_PKTBUF_SLAB_ALIGN)
+uint8_t _large_buf[CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF * _LARGE_SIZE];
+static uint8_t _snip_refs[CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF];
+static uint8_t _small_refs[CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF];
+static uint8_t _large_refs[CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF];
+
+static _slab_t _slabs[GNRC_PKTBUF_SLAB_NUMOF] = {
+    [GNRC_PKTBUF_SLAB_SNIP] = {
+        .buf = _snip_buf, .refs = _snip_refs,
+        .stats = { .size = _SNIP_SIZE,
+                   .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF },
+    },
+    [GNRC_PKTBUF_SLAB_SMALL] = {
+        .buf = _small_buf, .refs = _small_refs,
+        .stats = { .size = _SMALL_SIZE,
+                   .numof = CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF },
+    },
+    [GNRC_PKTBUF_SLAB_LARGE] = {
+        .buf = _large_buf, .refs = _large_refs,
+        .stats = { .size = _LARGE_SIZE,
+                   .numof = CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF },
+    },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+#ifdef MODULE_GNRC_PKTLAT
+    pkt->lat_layer = 0;
+#endif
+}
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    const uintptr_t start = (uintptr_t)slab->buf;
+    const uintptr_t end = start + (slab->stats.size * slab->stats.numof);
+    uintptr_t pos = (uintptr_t)ptr;
+
+    return ((pos >= start) && (pos < end));
+}
+
+static _slab_t *_slab_of(const void *ptr)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+/* index of the object of slab containing ptr */
+static inline unsigned _obj_idx(const _slab_t *slab, const void *ptr)
+{
+    return ((uintptr_t)ptr - (uintptr_t)slab->buf) / slab->stats.size;
+}
+
+static inline uint8_t *_obj(const _slab_t *slab, unsigned idx)
+{
+    return &slab->buf[idx * slab->stats.size];
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+
+        slab->free = NULL;
+        /* thread backwards, so the first object is handed out first */
+        for (unsigned j = slab->stats.numof; j > 0; j--) {
+            /* Silence false -Wcast-align: objects are aligned to
+             * GNRC_PKTBUF_SLAB_ALIGN */
+            _slab_free_t *obj = (_slab_free_t *)(uintptr_t)_obj(slab, j - 1);
+
+            obj->next = slab->free;
+            slab->free = obj;
+        }
+        memset(slab->refs, 0, slab->stats.numof);
+        slab->stats.used = 0;
+        slab->stats.max_used = 0;
+        slab->stats.fails = 0;
+        slab->stats.fallbacks = 0;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, (unsigned)_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    new_data_marked = pkt->data;
+    if ((pkt->size != size) && (size != _SLAB_ROUND(size))) {
+        /* the remaining section would start unaligned => move it to an object
+         * of its own, the marked section keeps the original one */
+        void *new_data_rest = _pktbuf_alloc(pkt->size - size);
+
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        pkt->data = new_data_rest;
+    }
+    else if (pkt->size != size) {
+        /* both sections now share the object and are released separately */
+        _slab_t *slab = _slab_of(pkt->data);
+
+        pkt->data = ((uint8_t *)pkt->data) + size;
+        if (slab != NULL) {
+            unsigned idx = _obj_idx(slab, pkt->data);
+
+            assert(slab->refs[idx] < UINT8_MAX);
+            slab->refs[idx]++;
+        }
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+/* checks if the data section at data can be grown to size without moving */
+static bool _fits_in_place(void *data, size_t size)
+{
+    _slab_t *slab = _slab_of(data);
+    unsigned idx;
+
+    if (slab == NULL) {
+        return false;
+    }
+    idx = _obj_idx(slab, data);
+    /* no other section may use the rest of the object */
+    return (slab->refs[idx] == 1) &&
+           ((((uint8_t *)data) - _obj(slab, idx)) + size <= slab->stats.size);
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size and does not fit the object */
+    else if ((size > pkt->size) &&
+             ((pkt->data == NULL) || !_fits_in_place(pkt->data, size))) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+        }
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = new_data;
+    }
+    /* shrinking keeps the object until the section is released */
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+#ifdef MODULE_GNRC_PKTLAT
+            new->lat_time = pkt->lat_time;
+            new->lat_layer = pkt->lat_layer;
+#endif
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_t cls,
+                                gnrc_pktbuf_slab_stats_t *stats)
+{
+    assert(cls < GNRC_PKTBUF_SLAB_NUMOF);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    *stats = _slabs[cls].stats;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snip", "small", "large" };
+
+    printf("packet buffer: %u bytes in %u size classes\n",
+           (unsigned)(sizeof(_snip_buf) + sizeof(_small_buf) + sizeof(_large_buf)),
+           GNRC_PKTBUF_SLAB_NUMOF);
+    puts("  class  size numof  used   max      fails  fallbacks");
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        gnrc_pktbuf_slab_stats_t stats;
+
+        gnrc_pktbuf_slab_get_stats(i, &stats);
+        printf("  %-5s %5u %5u %5u %5u %10" PRIu32 " %10" PRIu32 "\n",
+               names[i], stats.size, stats.numof, stats.used, stats.max_used,
+               stats.fails, stats.fallbacks);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (_slabs[i].stats.used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall obj in free list of slab: obj is at an object boundary of
+     *                                     slab and slab->refs of obj is 0
+     *  - forall slab: length of free list == slab->stats.numof - slab->stats.used
+     *  - forall slab: number of objects with slab->refs > 0 == slab->stats.used
+     */
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        const _slab_t *slab = &_slabs[i];
+        unsigned nfree = 0, used = 0;
+
+        for (_slab_free_t *ptr = slab->free; ptr != NULL; ptr = ptr->next) {
+            if (!_slab_contains(slab, ptr) ||
+                ((((uint8_t *)ptr) - slab->buf) % slab->stats.size) ||
+                (slab->refs[_obj_idx(slab, ptr)] != 0) ||
+                (++nfree > slab->stats.numof)) {
+                return false;
+            }
+        }
+        for (unsigned j = 0; j < slab->stats.numof; j++) {
+            if (slab->refs[j] > 0) {
+                used++;
+            }
+        }
+        if ((nfree != (unsigned)(slab->stats.numof - slab->stats.used)) ||
+            (used != slab->stats.used)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _slab_t *slab = &_slabs[0], *fitting = NULL;
+
+    for (; slab < &_slabs[GNRC_PKTBUF_SLAB_NUMOF]; slab++) {
+        if (size > slab->stats.size) {
+            continue;
+        }
+        if (fitting == NULL) {
+            fitting = slab;
+        }
+        if (slab->free != NULL) {
+            break;
+        }
+    }
+    if (fitting == NULL) {
+        DEBUG("pktbuf: size %u exceeds largest size class\n", (unsigned)size);
+        return NULL;
+    }
+    if (slab == &_slabs[GNRC_PKTBUF_SLAB_NUMOF]) {
+        DEBUG("pktbuf: no object of %u bytes or more left\n",
+              (unsigned)fitting->stats.size);
+        fitting->stats.fails++;
+        return NULL;
+    }
+    if (slab != fitting) {
+        fitting->stats.fallbacks++;
+    }
+
+    _slab_free_t *obj = slab->free;
+
+    slab->free = obj->next;
+    slab->refs[_obj_idx(slab, obj)] = 1;
+    if (++slab->stats.used > slab->stats.max_used) {
+        slab->stats.max_used = slab->stats.used;
+    }
+    return obj;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    _slab_t *slab = _slab_of(data);
+    unsigned idx;
+
+    (void)size;
+    if (slab == NULL) {
+        return;
+    }
+    idx = _obj_idx(slab, data);
+    assert(slab->refs[idx] > 0);
+    if (--slab->refs[idx] == 0) {
+        _slab_free_t *obj = (_slab_free_t *)(uintptr_t)_obj(slab, idx);
+
+        obj->next = slab->free;
+        slab->free = obj;
+        slab->stats.used--;
+    }
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    return _slab_of(ptr) != NULL;
+}
+
+/** @} */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @brief   Definitions of the size class implementation of
+ *          @ref net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Size classes and their statistics
+ */
+#ifndef PKTBUF_SLAB_H
+#define PKTBUF_SLAB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Alignment of the objects of all size classes
+ */
+#define GNRC_PKTBUF_SLAB_ALIGN      (8U)
+
+/**
+ * @brief   Size classes of the packet buffer
+ */
+typedef enum {
+    GNRC_PKTBUF_SLAB_SNIP = 0,      /**< packet snip descriptors */
+    GNRC_PKTBUF_SLAB_SMALL,         /**< headers and small payloads */
+    GNRC_PKTBUF_SLAB_LARGE,         /**< MTU-sized payloads */
+    GNRC_PKTBUF_SLAB_NUMOF,         /**< number of size classes */
+} gnrc_pktbuf_slab_class_t;
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    uint16_t size;          /**< object size in bytes */
+    uint16_t numof;         /**< number of objects */
+    uint16_t used;          /**< number of objects in use */
+    uint16_t max_used;      /**< maximum number of objects in use */
+    uint32_t fails;         /**< allocations that did not fit into this or
+                             *   any larger size class */
+    uint32_t fallbacks;     /**< allocations for this size class served by
+                             *   a larger one as this one was exhausted */
+} gnrc_pktbuf_slab_stats_t;
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * @param[in] cls       A size class.
+ * @param[out] stats    The statistics of @p cls.
+ */
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_t cls,
+                                gnrc_pktbuf_slab_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PKTBUF_SLAB_H */
+/** @} */
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "net/gnrc/pktlat.h"
+#include "ztimer.h"
+
+static gnrc_pktlat_stats_t _stats;
+
+static const char *_layer_str[] = {
+    [GNRC_PKTLAT_NONE] = "none",
+    [GNRC_PKTLAT_NETIF_RX] = "netif rx",
+    [GNRC_PKTLAT_IPV6_RX] = "ipv6 rx",
+    [GNRC_PKTLAT_TRANSPORT_RX] = "transport rx",
+    [GNRC_PKTLAT_SOCK_TX] = "sock tx",
+    [GNRC_PKTLAT_TRANSPORT_TX] = "transport tx",
+    [GNRC_PKTLAT_IPV6_TX] = "ipv6 tx",
+    [GNRC_PKTLAT_NETIF_TX] = "netif tx",
+};
+
+static inline bool _is_tx(gnrc_pktlat_layer_t layer)
+{
+    return layer >= GNRC_PKTLAT_SOCK_TX;
+}
+
+/* the first snip is the payload on reception, on transmission it is the last
+ * one, only followed by the TX sync snip if any */
+static gnrc_pktsnip_t *_carrier(gnrc_pktsnip_t *pkt, gnrc_pktlat_layer_t layer)
+{
+    if (!_is_tx(layer) || (pkt == NULL)) {
+        return pkt;
+    }
+    while ((pkt->next != NULL) && (pkt->next->type != GNRC_NETTYPE_TX_SYNC)) {
+        pkt = pkt->next;
+    }
+    return pkt;
+}
+
+static void _account(gnrc_pktsnip_t *snip, uint32_t now)
+{
+    if (snip->lat_layer == GNRC_PKTLAT_NONE) {
+        return;
+    }
+
+    gnrc_pktlat_hist_t *hist = &_stats.layer[snip->lat_layer - 1];
+    uint32_t dwell = now - snip->lat_time;
+    unsigned bucket = (dwell == 0) ? 0 : bitarithm_msb(dwell) + 1;
+
+    if (bucket >= CONFIG_GNRC_PKTLAT_HIST_BUCKETS) {
+        bucket = CONFIG_GNRC_PKTLAT_HIST_BUCKETS - 1;
+    }
+
+    unsigned state = irq_disable();
+    hist->sum += dwell;
+    hist->count++;
+    if (dwell > hist->max) {
+        hist->max = dwell;
+    }
+    hist->hist[bucket]++;
+    irq_restore(state);
+}
+
+void gnrc_pktlat_init(void)
+{
+    /* packets are stamped from any thread, so the clock is kept running */
+    ztimer_acquire(ZTIMER_USEC);
+}
+
+void gnrc_pktlat_stamp(gnrc_pktsnip_t *pkt, gnrc_pktlat_layer_t layer)
+{
+    gnrc_pktsnip_t *snip = _carrier(pkt, layer);
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    assert((layer > GNRC_PKTLAT_NONE) && (layer < GNRC_PKTLAT_NUMOF));
+    if (snip == NULL) {
+        return;
+    }
+    _account(snip, now);
+    snip->lat_time = now;
+    snip->lat_layer = layer;
+}
+
+void gnrc_pktlat_done(gnrc_pktsnip_t *pkt, gnrc_pktlat_layer_t layer)
+{
+    gnrc_pktsnip_t *snip = _carrier(pkt, layer);
+
+    if ((snip == NULL) || (snip->lat_layer == GNRC_PKTLAT_NONE)) {
+        return;
+    }
+    _account(snip, ztimer_now(ZTIMER_USEC));
+    snip->lat_layer = GNRC_PKTLAT_NONE;
+}
+
+void gnrc_pktlat_get(gnrc_pktlat_layer_t layer, gnrc_pktlat_hist_t *hist)
+{
+    assert((layer > GNRC_PKTLAT_NONE) && (layer < GNRC_PKTLAT_NUMOF));
+
+    unsigned state = irq_disable();
+    *hist = _stats.layer[layer - 1];
+    irq_restore(state);
+}
+
+void gnrc_pktlat_get_all(gnrc_pktlat_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _stats;
+    irq_restore(state);
+}
+
+void gnrc_pktlat_reset(void)
+{
+    unsigned state = irq_disable();
+    memset(&_stats, 0, sizeof(_stats));
+    irq_restore(state);
+}
+
+const char *gnrc_pktlat_layer_str(gnrc_pktlat_layer_t layer)
+{
+    if (layer >= GNRC_PKTLAT_NUMOF) {
+        return "unknown";
+    }
+    return _layer_str[layer];
+}
+
+/** @} */
@@ -17,12 +17,15 @@
 #include <errno.h>
 #include <stdlib.h>
 
+#include "container.h"
+#include "irq.h"
 #include "log.h"
 #include "net/af.h"
 #include "net/ipv6/hdr.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
 #include "net/gnrc/netreg.h"
+#include "net/gnrc/pktlat.h"
 #include "net/gnrc/tx_sync.h"
 #include "net/udp.h"
 #include "utlist.h"
@@ -94,14 +97,72 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_register(type, &reg->entry);
 }
 
-ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
-                       uint32_t timeout, sock_ip_ep_t *remote,
-                       gnrc_sock_recv_aux_t *aux)
+static int _recv_msg(const msg_t *msg, gnrc_pktsnip_t **pkt_out,
+                     sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux)
 {
     /* only used when some sock_aux_% module is used */
     (void)aux;
     gnrc_pktsnip_t *pkt, *netif;
+
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            pkt = msg->content.ptr;
+            gnrc_pktlat_done(pkt, GNRC_PKTLAT_TRANSPORT_RX);
+            break;
+#if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC)
+        case _TIMEOUT_MSG_TYPE:
+            if (msg->content.value == _TIMEOUT_MAGIC) {
+                return -ETIMEDOUT;
+            }
+#endif
+            /* Falls Through. */
+        default:
+            return -EINVAL;
+    }
+    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
+     * was implemented */
+    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
+    assert(ipv6_hdr != NULL);
+    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
+    remote->family = AF_INET6;
+#if IS_USED(MODULE_SOCK_AUX_LOCAL)
+    if (aux->local != NULL) {
+        memcpy(&aux->local->addr, &ipv6_hdr->dst, sizeof(ipv6_addr_t));
+        aux->local->family = AF_INET6;
+    }
+#endif /* MODULE_SOCK_AUX_LOCAL */
+    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif == NULL) {
+        remote->netif = SOCK_ADDR_ANY_NETIF;
+    }
+    else {
+        gnrc_netif_hdr_t *netif_hdr = netif->data;
+        /* TODO: use API in #5511 */
+        remote->netif = (uint16_t)netif_hdr->if_pid;
+#if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
+        if (aux->timestamp != NULL) {
+            if (gnrc_netif_hdr_get_timestamp(netif_hdr, aux->timestamp) == 0) {
+                aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP;
+            }
+        }
+#endif /* MODULE_SOCK_AUX_TIMESTAMP */
+#if IS_USED(MODULE_SOCK_AUX_RSSI)
+        if ((aux->rssi) && (netif_hdr->rssi != GNRC_NETIF_HDR_NO_RSSI)) {
+            aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_RSSI;
+            *aux->rssi = netif_hdr->rssi;
+        }
+#endif /* MODULE_SOCK_AUX_RSSI */
+    }
+    *pkt_out = pkt; /* set out parameter */
+    return 0;
+}
+
+ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                       uint32_t timeout, sock_ip_ep_t *remote,
+                       gnrc_sock_recv_aux_t *aux)
+{
     msg_t msg;
+    int res;
 
     /* The fuzzing module is only enabled when building a fuzzing
      * application from the fuzzing/ subdirectory. When using gnrc_sock
@@ -162,55 +223,10 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
 #elif IS_USED(MODULE_XTIMER)
     xtimer_remove(&timeout_timer);
 #endif
-    switch (msg.type) {
-        case GNRC_NETAPI_MSG_TYPE_RCV:
-            pkt = msg.content.ptr;
-            break;
-#if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER_USEC)
-        case _TIMEOUT_MSG_TYPE:
-            if (msg.content.value == _TIMEOUT_MAGIC) {
-                return -ETIMEDOUT;
-            }
-#endif
-            /* Falls Through. */
-        default:
-            return -EINVAL;
-    }
-    /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
-     * was implemented */
-    ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
-    assert(ipv6_hdr != NULL);
-    memcpy(&remote->addr, &ipv6_hdr->src, sizeof(ipv6_addr_t));
-    remote->family = AF_INET6;
-#if IS_USED(MODULE_SOCK_AUX_LOCAL)
-    if (aux->local != NULL) {
-        memcpy(&aux->local->addr, &ipv6_hdr->dst, sizeof(ipv6_addr_t));
-        aux->local->family = AF_INET6;
-    }
-#endif /* MODULE_SOCK_AUX_LOCAL */
-    netif = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
-    if (netif == NULL) {
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-    }
-    else {
-        gnrc_netif_hdr_t *netif_hdr = netif->data;
-        /* TODO: use API in #5511 */
-        remote->netif = (uint16_t)netif_hdr->if_pid;
-#if IS_USED(MODULE_SOCK_AUX_TIMESTAMP)
-        if (aux->timestamp != NULL) {
-            if (gnrc_netif_hdr_get_timestamp(netif_hdr, aux->timestamp) == 0) {
-                aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_TIMESTAMP;
-            }
-        }
-#endif /* MODULE_SOCK_AUX_TIMESTAMP */
-#if IS_USED(MODULE_SOCK_AUX_RSSI)
-        if ((aux->rssi) && (netif_hdr->rssi != GNRC_NETIF_HDR_NO_RSSI)) {
-            aux->flags |= GNRC_SOCK_RECV_AUX_FLAG_RSSI;
-            *aux->rssi = netif_hdr->rssi;
-        }
-#endif /* MODULE_SOCK_AUX_RSSI */
+    res = _recv_msg(&msg, pkt_out, remote, aux);
+    if (res < 0) {
+        return res;
     }
-    *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
     if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
@@ -218,12 +234,48 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 #ifdef MODULE_FUZZING
-    gnrc_sock_prevpkt = pkt;
+    gnrc_sock_prevpkt = *pkt_out;
 #endif
 
     return 0;
 }
 
+size_t gnrc_sock_recv_queued(gnrc_sock_reg_t *reg, gnrc_sock_recv_cb_t cb, void *arg,
+                             size_t num)
+{
+    msg_t msgs[GNRC_SOCK_MBOX_SIZE];
+    size_t queued = 0;
+
+    if (num > ARRAY_SIZE(msgs)) {
+        num = ARRAY_SIZE(msgs);
+    }
+    /* Take the queued messages out of the mbox with a single critical
+     * section. Packets are only ever put into the mbox without blocking, so
+     * there are no writers to wake up. */
+    unsigned state = irq_disable();
+    while ((queued < num) && cib_avail(&reg->mbox.cib)) {
+        msgs[queued++] = reg->mbox.msg_array[cib_get_unsafe(&reg->mbox.cib)];
+    }
+    irq_restore(state);
+
+    for (size_t i = 0; i < queued; i++) {
+        gnrc_sock_recv_aux_t aux = { 0 };
+        gnrc_pktsnip_t *pkt;
+        sock_ip_ep_t remote = { .family = AF_INET6 };
+
+        /* stale timeout messages are skipped */
+        if (_recv_msg(&msgs[i], &pkt, &remote, &aux) == 0) {
+            cb(pkt, &remote, arg);
+        }
+    }
+#if IS_ACTIVE(SOCK_HAS_ASYNC)
+    if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
+        reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
+    }
+#endif
+    return queued;
+}
+
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh)
 {
@@ -238,6 +290,7 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     gnrc_tx_sync_t tx_sync;
 #endif
 
+    gnrc_pktlat_stamp(payload, GNRC_PKTLAT_SOCK_TX);
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
         return -EAFNOSUPPORT;
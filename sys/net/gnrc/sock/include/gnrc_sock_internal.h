@@ -150,6 +150,29 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote, gnrc_sock_recv_aux_t *aux);
 
+/**
+ * @brief   Handles a packet taken from the mbox by @ref gnrc_sock_recv_queued
+ * @internal
+ *
+ * @param[in] pkt       The received packet, owned by the callback.
+ * @param[in] remote    Remote end point of @p pkt.
+ * @param[in] arg       Argument given to @ref gnrc_sock_recv_queued.
+ */
+typedef void (*gnrc_sock_recv_cb_t)(gnrc_pktsnip_t *pkt, const sock_ip_ep_t *remote,
+                                   void *arg);
+
+/**
+ * @brief   Receive the packets already queued internally without blocking
+ * @internal
+ *
+ * All queued messages, but at most @p num, are taken from the mbox at once.
+ * The packets among them are handed to @p cb one by one.
+ *
+ * @return  Number of messages taken from the mbox, 0 if it was empty
+ */
+size_t gnrc_sock_recv_queued(gnrc_sock_reg_t *reg, gnrc_sock_recv_cb_t cb, void *arg,
+                             size_t num);
+
 /**
  * @brief   Send a packet internally
  * @internal
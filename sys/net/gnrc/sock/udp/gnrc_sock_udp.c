@@ -237,6 +237,61 @@ static bool _accept_remote(const sock_udp_t *sock, const udp_hdr_t *hdr,
     return true;
 }
 
+/**
+ * @brief   State of @ref sock_udp_recv_many() while taking queued datagrams
+ */
+typedef struct {
+    sock_udp_t *sock;           /**< the sock received from */
+    sock_udp_mmsg_t *msgs;      /**< space for the datagrams */
+    size_t received;            /**< number of datagrams in msgs */
+} _recv_many_t;
+
+static void _recv_many_cb(gnrc_pktsnip_t *pkt, const sock_ip_ep_t *remote, void *arg)
+{
+    _recv_many_t *ctx = arg;
+    sock_udp_mmsg_t *msg = &ctx->msgs[ctx->received];
+    gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    udp_hdr_t *hdr;
+
+    assert(udp);
+    hdr = udp->data;
+    /* datagrams the sock does not accept or that do not fit are dropped */
+    if (_accept_remote(ctx->sock, hdr, remote) && (pkt->size <= msg->len)) {
+        memcpy(msg->data, pkt->data, pkt->size);
+        msg->msg_len = pkt->size;
+        if (msg->remote != NULL) {
+            memcpy(msg->remote, remote, sizeof(*remote));
+            msg->remote->port = byteorder_ntohs(hdr->src_port);
+        }
+        ctx->received++;
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+ssize_t sock_udp_recv_many(sock_udp_t *sock, sock_udp_mmsg_t *msgs, size_t num,
+                           uint32_t timeout)
+{
+    _recv_many_t ctx = { .sock = sock, .msgs = msgs };
+    ssize_t res;
+    size_t taken;
+
+    assert((sock != NULL) && (msgs != NULL) && (num > 0));
+    /* only wait for the first datagram */
+    res = sock_udp_recv(sock, msgs[0].data, msgs[0].len, timeout, msgs[0].remote);
+    if (res < 0) {
+        return res;
+    }
+    msgs[0].msg_len = res;
+    ctx.received = 1;
+    /* take the datagrams queued meanwhile from the mbox in batches instead of
+     * one by one */
+    do {
+        taken = gnrc_sock_recv_queued(&sock->reg, _recv_many_cb, &ctx,
+                                      num - ctx.received);
+    } while ((taken > 0) && (ctx.received < num));
+    return ctx.received;
+}
+
 ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
                               uint32_t timeout, sock_udp_ep_t *remote,
                               sock_udp_aux_rx_t *aux)
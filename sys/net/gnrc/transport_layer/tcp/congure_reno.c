@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       CongURE TCP Reno and ABE setup for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/congestion.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_congure.h"
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+#include "congure/abe.h"
+#endif
+
+#define TCP_CONGURE_RENO_CONSTS { \
+        .fr = _fr, \
+        .same_wnd_adv = _same_wnd_adv, \
+        .ss_cwnd_inc = _ss_cwnd_inc, \
+        .ca_cwnd_inc = _ca_cwnd_inc, \
+        .init_mss = CONFIG_GNRC_TCP_MSS, \
+        .cwnd_upper = 2190U, \
+        .cwnd_lower = 1095U, \
+        .init_ssthresh = CONGURE_WND_SIZE_MAX, \
+        .frthresh = DUPACK_THRESHOLD, \
+    }
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+static void _ss_cwnd_inc(congure_reno_snd_t *c);
+static void _ca_cwnd_inc(congure_reno_snd_t *c);
+
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = TCP_CONGURE_RENO_CONSTS;
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+static const congure_abe_snd_consts_t _tcp_congure_abe_consts = {
+    .reno = TCP_CONGURE_RENO_CONSTS,
+    .abe_multiplier_numerator = CONFIG_CONGURE_ABE_MULTIPLIER_NUMERATOR_DEFAULT,
+    .abe_multiplier_denominator = CONFIG_CONGURE_ABE_MULTIPLIER_DENOMINATOR_DEFAULT,
+};
+#endif
+
+void gnrc_tcp_congure_reno_setup(congure_reno_snd_t *c)
+{
+    congure_reno_snd_setup(c, &_tcp_congure_reno_consts);
+}
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+void gnrc_tcp_congure_abe_setup(congure_abe_snd_t *c)
+{
+    congure_abe_snd_setup(c, &_tcp_congure_abe_consts);
+}
+#endif
+
+void _gnrc_tcp_congure_reno_set_mss(congure_snd_t *c, uint32_t smss)
+{
+    /* both the Reno and the ABE driver initialize with congure_reno_snd_init() */
+    if (c->driver->init != congure_reno_snd_init) {
+        return;
+    }
+    congure_reno_set_mss((congure_reno_snd_t *)c,
+                         (smss < CONGURE_WND_SIZE_MAX) ? smss : CONGURE_WND_SIZE_MAX);
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* GNRC TCP detects lost segments and retransmits them itself, so
+     * do nothing */
+    return;
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+    uint32_t wnd = (tcb->snd_wnd < CONGURE_WND_SIZE_MAX) ? tcb->snd_wnd : CONGURE_WND_SIZE_MAX;
+
+    return ack->wnd == wnd;
+}
+
+static void _cwnd_inc(congure_reno_snd_t *c, congure_wnd_size_t inc)
+{
+    /* Saturate instead of wrapping around the window unit */
+    if ((CONGURE_WND_SIZE_MAX - c->super.cwnd) < inc) {
+        c->super.cwnd = CONGURE_WND_SIZE_MAX;
+    }
+    else {
+        c->super.cwnd += inc;
+    }
+}
+
+static void _ss_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 equation 2 */
+    _cwnd_inc(c, (c->in_flight_size < c->mss) ? c->in_flight_size : c->mss);
+}
+
+static void _ca_cwnd_inc(congure_reno_snd_t *c)
+{
+    /* see https://tools.ietf.org/html/rfc5681#section-3.1 equation 3 */
+    uint32_t inc = ((uint32_t)c->mss * c->mss) / c->super.cwnd;
+
+    _cwnd_inc(c, (inc > 0) ? inc : 1);
+}
+
+/** @} */
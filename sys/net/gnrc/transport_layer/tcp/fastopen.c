@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/fastopen.h
+ * @}
+ */
+
+#include <string.h>
+
+#include "assert.h"
+#include "crypto/helper.h"
+#include "hashes/aes128_cmac.h"
+#include "mutex.h"
+#include "net/tcp.h"
+#include "random.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fastopen.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert((CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN >= TCP_OPTION_LENGTH_TFO_COOKIE_MIN) &&
+              (CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN <= TCP_OPTION_LENGTH_TFO_COOKIE_MAX) &&
+              !(CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN & 1),
+              "RFC 7413 requires an even cookie length from 4 to 16 bytes");
+
+/**
+ * @brief Cookie handed out by a peer.
+ */
+typedef struct {
+    uint8_t addr[sizeof(((gnrc_tcp_tcb_t *)NULL)->peer_addr)]; /**< Address of the peer */
+    uint16_t mss;                                   /**< MSS announced by the peer */
+    uint8_t cookie_len;                             /**< Cookie length, zero if unused */
+    uint8_t cookie[TCP_OPTION_LENGTH_TFO_COOKIE_MAX]; /**< Cookie */
+} _cache_entry_t;
+
+/**
+ * @brief Secret key the cookies of this host are derived from.
+ */
+static uint8_t _key[AES128_CMAC_BLOCK_SIZE];
+
+/**
+ * @brief Cookie cache, ordered from most to least recently used.
+ */
+static _cache_entry_t _cache[CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE];
+
+/**
+ * @brief Protects _cache, it is used from user threads and the TCP thread.
+ */
+static mutex_t _cache_lock = MUTEX_INIT;
+
+/**
+ * @brief Searches the cache entry of the peer of a connection.
+ *
+ * @note Must be called with _cache_lock held.
+ *
+ * @param[in] tcb   TCB holding the peer address.
+ *
+ * @returns   Index of the entry.
+ *            CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE if there is none.
+ */
+static unsigned _cache_find(const gnrc_tcp_tcb_t *tcb)
+{
+    unsigned i = 0;
+
+    while (i < CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE && _cache[i].cookie_len > 0 &&
+           memcmp(_cache[i].addr, tcb->peer_addr, sizeof(_cache[i].addr)) != 0) {
+        i++;
+    }
+    if (i < CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE && _cache[i].cookie_len == 0) {
+        i = CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE;
+    }
+    return i;
+}
+
+void _gnrc_tcp_fastopen_init(void)
+{
+    TCP_DEBUG_ENTER;
+    random_bytes(_key, sizeof(_key));
+    mutex_lock(&_cache_lock);
+    memset(_cache, 0, sizeof(_cache));
+    mutex_unlock(&_cache_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_fastopen_cookie_gen(const gnrc_tcp_tcb_t *tcb, uint8_t *cookie)
+{
+    TCP_DEBUG_ENTER;
+    aes128_cmac_context_t ctx;
+    uint8_t digest[AES128_CMAC_BLOCK_SIZE];
+
+    /* The cookie is a MAC of the client address (RFC 7413, section 4.1.2) */
+    aes128_cmac_init(&ctx, _key, sizeof(_key));
+    aes128_cmac_update(&ctx, tcb->peer_addr, sizeof(tcb->peer_addr));
+    aes128_cmac_final(&ctx, digest);
+    memcpy(cookie, digest, CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN);
+    TCP_DEBUG_LEAVE;
+}
+
+bool _gnrc_tcp_fastopen_cookie_valid(const gnrc_tcp_tcb_t *tcb, const uint8_t *cookie,
+                                     uint8_t cookie_len)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t expected[CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN];
+
+    if (cookie_len != CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN) {
+        TCP_DEBUG_LEAVE;
+        return false;
+    }
+    _gnrc_tcp_fastopen_cookie_gen(tcb, expected);
+    TCP_DEBUG_LEAVE;
+    return crypto_equals(expected, cookie, sizeof(expected)) == 1;
+}
+
+uint8_t _gnrc_tcp_fastopen_cache_get(const gnrc_tcp_tcb_t *tcb, uint8_t *cookie, uint16_t *mss)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t cookie_len = 0;
+
+    mutex_lock(&_cache_lock);
+    unsigned i = _cache_find(tcb);
+    if (i < CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE) {
+        _cache_entry_t entry = _cache[i];
+
+        /* Move entry to the front, it is the most recently used one now */
+        memmove(&_cache[1], &_cache[0], i * sizeof(_cache[0]));
+        _cache[0] = entry;
+
+        cookie_len = entry.cookie_len;
+        memcpy(cookie, entry.cookie, cookie_len);
+        *mss = entry.mss;
+    }
+    mutex_unlock(&_cache_lock);
+    TCP_DEBUG_LEAVE;
+    return cookie_len;
+}
+
+void _gnrc_tcp_fastopen_cache_set(const gnrc_tcp_tcb_t *tcb, const uint8_t *cookie,
+                                  uint8_t cookie_len)
+{
+    TCP_DEBUG_ENTER;
+    assert(cookie_len > 0 && cookie_len <= TCP_OPTION_LENGTH_TFO_COOKIE_MAX);
+
+    mutex_lock(&_cache_lock);
+    unsigned i = _cache_find(tcb);
+    if (i == CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE) {
+        /* Replace the least recently used entry */
+        i = CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE - 1;
+    }
+    memmove(&_cache[1], &_cache[0], i * sizeof(_cache[0]));
+    memcpy(_cache[0].addr, tcb->peer_addr, sizeof(_cache[0].addr));
+    _cache[0].mss = tcb->mss;
+    _cache[0].cookie_len = cookie_len;
+    memcpy(_cache[0].cookie, cookie, cookie_len);
+    mutex_unlock(&_cache_lock);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_fastopen_cache_del(const gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&_cache_lock);
+    unsigned i = _cache_find(tcb);
+    if (i < CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE) {
+        memmove(&_cache[i], &_cache[i + 1],
+                (CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE - i - 1) * sizeof(_cache[0]));
+        memset(&_cache[CONFIG_GNRC_TCP_FASTOPEN_CACHE_SIZE - 1], 0, sizeof(_cache[0]));
+    }
+    mutex_unlock(&_cache_lock);
+    TCP_DEBUG_LEAVE;
+}
@@ -24,15 +24,18 @@
 
 #include "evtimer.h"
 #include "evtimer_mbox.h"
+#include "iolist.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
 #include "net/gnrc/tcp.h"
+#include "net/gnrc/tcp/congestion.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_fastopen.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -297,6 +300,11 @@ int gnrc_tcp_init(void)
     /* Initialize receive buffers */
     _gnrc_tcp_rcvbuf_init();
 
+    /* Initialize TCP Fast Open cookie secret and cache */
+    if (IS_USED(MODULE_GNRC_TCP_FASTOPEN)) {
+        _gnrc_tcp_fastopen_init();
+    }
+
     /* Initialize timers */
     evtimer_init_mbox(&_tcp_mbox_timer);
 
@@ -325,6 +333,20 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+void gnrc_tcp_tcb_set_congure(gnrc_tcp_tcb_t *tcb, congure_snd_t *congure)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(congure == NULL || congure->driver != NULL);
+
+    mutex_lock(&(tcb->function_lock));
+    tcb->congure = congure;
+    mutex_unlock(&(tcb->function_lock));
+    TCP_DEBUG_LEAVE;
+}
+#endif
+
 void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
 {
     TCP_DEBUG_ENTER;
@@ -336,7 +358,21 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     TCP_DEBUG_LEAVE;
 }
 
-int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port)
+/**
+ * @brief Opens a connection, optionally using TCP Fast Open.
+ *
+ * @param[in,out] tcb          TCB for this connection.
+ * @param[in]     remote       Remote endpoint to connect to.
+ * @param[in]     local_port   Local port, PORT_UNSPEC for a random one.
+ * @param[in]     data         Data to send along with the SYN. NULL to open
+ *                             the connection without TCP Fast Open.
+ * @param[in]     len          Number of bytes in @p data.
+ *
+ * @returns   Number of bytes of @p data acknowledged during connection setup.
+ *            Negative errno on error, see gnrc_tcp_open().
+ */
+static ssize_t _open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port,
+                     const void *data, size_t len)
 {
     /* Sanity checking */
     TCP_DEBUG_ENTER;
@@ -405,7 +441,7 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
     _sched_connection_timeout(&tcb->event_misc, &mbox);
 
     /* Call FSM with event: CALL_OPEN */
-    int ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+    ssize_t ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, (void *)data, len);
     if (ret == -ENOMEM) {
         TCP_DEBUG_ERROR("-ENOMEM: All receive buffers are in use.");
     }
@@ -444,13 +480,47 @@ int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t loc
         TCP_DEBUG_ERROR("-ECONNREFUSED: Connection was refused by peer.");
         ret = -ECONNREFUSED;
     }
+    /* Data sent along with the SYN is acknowledged with the SYN */
+    if (ret == 0) {
+        ret = tcb->snd_una - tcb->iss - 1;
+    }
     mutex_unlock(&(tcb->function_lock));
     TCP_DEBUG_LEAVE;
     return ret;
 }
 
-int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
-                    const gnrc_tcp_ep_t *local)
+int gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote, uint16_t local_port)
+{
+    return _open(tcb, remote, local_port, NULL, 0);
+}
+
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN)
+ssize_t gnrc_tcp_open_fastopen(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
+                               uint16_t local_port, const void *data, size_t len)
+{
+    /* Without data, only a cookie for the next connection is requested */
+    static const uint8_t empty;
+
+    assert(data != NULL || len == 0);
+    return _open(tcb, remote, local_port, (data != NULL) ? data : &empty, len);
+}
+#endif
+
+/**
+ * @brief Configures a sequence of TCBs to wait for incoming connections,
+ *        optionally accepting TCP Fast Open.
+ *
+ * @param[in,out] queue      Listening queue for incoming connections.
+ * @param[in]     tcbs       TCBs associated with @p queue.
+ * @param[in]     tcbs_len   Number of TCBs behind @p tcbs.
+ * @param[in]     local      Endpoint specifying address and port to listen on.
+ * @param[in]     fastopen   Hand out cookies and accept data of SYNs with a
+ *                           valid cookie.
+ *
+ * @returns   0 on success. Negative errno on error, see gnrc_tcp_listen().
+ */
+static int _listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                   const gnrc_tcp_ep_t *local, bool fastopen)
 {
     /* Sanity checks */
     assert(queue != NULL);
@@ -508,6 +578,9 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
 #endif
             tcb->local_port = local->port;
             tcb->status |= STATUS_LISTENING;
+            if (fastopen) {
+                tcb->status |= STATUS_FASTOPEN_LISTEN;
+            }
 
             /* Open connection */
             ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
@@ -516,7 +589,7 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
         /* If anything goes wrong, discard all potentially opened connections. */
         if (ret) {
             for (size_t j = 0; j <= i; ++j) {
-                tcb->status &= ~(STATUS_LISTENING);
+                tcb->status &= ~(STATUS_LISTENING | STATUS_FASTOPEN_LISTEN);
                 _abort(tcb);
             }
             break;
@@ -537,6 +610,20 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
     return ret;
 }
 
+int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                    const gnrc_tcp_ep_t *local)
+{
+    return _listen(queue, tcbs, tcbs_len, local, false);
+}
+
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN)
+int gnrc_tcp_listen_fastopen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs,
+                             size_t tcbs_len, const gnrc_tcp_ep_t *local)
+{
+    return _listen(queue, tcbs, tcbs_len, local, true);
+}
+#endif
+
 int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
                     const uint32_t user_timeout_duration_ms)
 {
@@ -658,13 +745,22 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
     return ret;
 }
 
-ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
-                      const uint32_t timeout_duration_ms)
+/**
+ * @brief Queues data for transmission, blocks until something was queued.
+ *
+ * @param[in,out] tcb                   TCB holding the connection information.
+ * @param[in]     event                 FSM_EVENT_CALL_SEND or FSM_EVENT_CALL_SEND_PKT.
+ * @param[in,out] buf                   Data to send, iolist_t or gnrc_pktsnip_t ** depending
+ *                                      on @p event.
+ * @param[in]     len                   Number of bytes in @p buf.
+ * @param[in]     timeout_duration_ms   User specified timeout, see gnrc_tcp_send().
+ *
+ * @returns   Number of bytes queued or negative errno, see gnrc_tcp_send().
+ */
+static ssize_t _send(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event, void *buf,
+                     const size_t len, const uint32_t timeout_duration_ms)
 {
     TCP_DEBUG_ENTER;
-    assert(tcb != NULL);
-    assert(data != NULL);
-
     msg_t msg;
     msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
     mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
@@ -705,8 +801,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was queued for transmission */
+    while (ret == 0) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -717,7 +813,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         }
 
         /* If the send window is closed: Setup Probing */
-        if (tcb->snd_wnd <= 0) {
+        if (tcb->snd_wnd == 0) {
             /* If this is the first probe: Setup probing duration */
             if (!probing_mode) {
                 probing_mode = true;
@@ -731,7 +827,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
         /* Try to send data in case there nothing has been sent and we are not probing */
         if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+            ret = _gnrc_tcp_fsm(tcb, event, NULL, buf, len);
         }
 
         /* Wait for responses */
@@ -746,7 +842,6 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                 ret = -ETIMEDOUT;
                 break;
@@ -795,6 +890,35 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     return ret;
 }
 
+ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
+                      const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+    assert(data != NULL);
+
+    iolist_t iol = { .iol_next = NULL, .iol_base = (void *)data, .iol_len = len };
+    return _send(tcb, FSM_EVENT_CALL_SEND, &iol, len, timeout_duration_ms);
+}
+
+ssize_t gnrc_tcp_send_iolist(gnrc_tcp_tcb_t *tcb, const iolist_t *iolist,
+                             const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+
+    return _send(tcb, FSM_EVENT_CALL_SEND, (void *)iolist, iolist_size(iolist),
+                 timeout_duration_ms);
+}
+
+ssize_t gnrc_tcp_send_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **pkt,
+                          const uint32_t timeout_duration_ms)
+{
+    assert(tcb != NULL);
+    assert(pkt != NULL);
+    assert(*pkt == NULL || (*pkt)->users == 1);
+
+    return _send(tcb, FSM_EVENT_CALL_SEND_PKT, pkt, gnrc_pkt_len(*pkt), timeout_duration_ms);
+}
+
 ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
                       const uint32_t timeout_duration_ms)
 {
@@ -892,7 +1016,6 @@ ssize_t gnrc_tcp_recv(gnrc_tcp_tcb_t *tcb, void *data, const size_t max_len,
 
                 case MSG_TYPE_USER_SPEC_TIMEOUT:
                     TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
-                    _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                     TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                     ret = -ETIMEDOUT;
                     break;
@@ -952,7 +1075,7 @@ void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
         mutex_lock(&(tcb->function_lock));
 
         /* Clear LISTENING status causing re-opening on close */
-        tcb->status &= ~(STATUS_LISTENING);
+        tcb->status &= ~(STATUS_LISTENING | STATUS_FASTOPEN_LISTEN);
         _close(tcb);
 
         mutex_unlock(&(tcb->function_lock));
@@ -1031,6 +1154,19 @@ int gnrc_tcp_get_remote(gnrc_tcp_tcb_t *tcb, gnrc_tcp_ep_t *ep)
     return ret;
 }
 
+void gnrc_tcp_get_rcvbuf_stats(gnrc_tcp_tcb_t *tcb, gnrc_tcp_rcvbuf_stats_t *stats)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+    assert(stats != NULL);
+
+    /* The receive buffer is resized by the FSM */
+    mutex_lock(&(tcb->fsm_lock));
+    _gnrc_tcp_rcvbuf_get_stats(tcb, stats);
+    mutex_unlock(&(tcb->fsm_lock));
+    TCP_DEBUG_LEAVE;
+}
+
 int gnrc_tcp_queue_get_local(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_ep_t *ep)
 {
     TCP_DEBUG_ENTER;
@@ -23,6 +23,7 @@
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
+#include "net/gnrc/pktlat.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_fsm.h"
@@ -301,12 +302,15 @@ static void *_eventloop(__attribute__((unused)) void *arg)
             /* Pass message up the network stack */
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_RCV.");
+                /* payload is copied into the receive buffer of the TCB */
+                gnrc_pktlat_done(msg.content.ptr, GNRC_PKTLAT_TRANSPORT_RX);
                 _receive((gnrc_pktsnip_t *)msg.content.ptr);
                 break;
 
             /* Pass message down the network stack */
             case GNRC_NETAPI_MSG_TYPE_SND:
                 TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_SND.");
+                gnrc_pktlat_stamp(msg.content.ptr, GNRC_PKTLAT_TRANSPORT_TX);
                 _send((gnrc_pktsnip_t *)msg.content.ptr);
                 break;
 
@@ -330,6 +334,13 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                               FSM_EVENT_TIMEOUT_TIMEWAIT, NULL, NULL, 0);
                 break;
 
+            /* Receive buffer autotuning timer expired: Call FSM to let an idle buffer shrink */
+            case MSG_TYPE_RCVBUF:
+                TCP_DEBUG_INFO("Received MSG_TYPE_RCVBUF.");
+                _gnrc_tcp_fsm((gnrc_tcp_tcb_t *)msg.content.ptr,
+                              FSM_EVENT_TIMEOUT_RCVBUF, NULL, NULL, 0);
+                break;
+
            /* A connection opening attempt from a TCB in listening mode failed.
             * Clear retransmission and re-open for next attempt */
             case MSG_TYPE_CONNECTION_TIMEOUT:
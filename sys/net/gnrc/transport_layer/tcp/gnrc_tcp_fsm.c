@@ -19,6 +19,10 @@
 
 #include <utlist.h>
 #include <errno.h>
+#include <string.h>
+#include "assert.h"
+#include "bitarithm.h"
+#include "iolist.h"
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
@@ -26,11 +30,20 @@
 #include "evtimer_msg.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_fastopen.h"
 #include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 #include "include/gnrc_tcp_fsm.h"
 
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+#include "congure.h"
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+#include "include/gnrc_tcp_congure.h"
+#endif
+
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
@@ -92,15 +105,584 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->rtx_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+            gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+        }
+        tcb->rtx_len = 0;
     }
+    tcb->rtx_sacked = 0;
+    tcb->rtx_lost = 0;
+    tcb->rtx_resent = 0;
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Calculates the sender maximum segment size (SMSS).
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The smaller one of the peers MSS and our MSS.
+ */
+static uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    /* Use our MSS if the peer didn't announce one */
+    if (tcb->mss == 0 || tcb->mss > CONFIG_GNRC_TCP_MSS) {
+        return CONFIG_GNRC_TCP_MSS;
+    }
+    return tcb->mss;
+}
+
+/**
+ * @brief Calculates the amount of data in flight (RFC 6675, section 4).
+ *
+ * Segments that were selectively acknowledged or are considered lost
+ * and not retransmitted yet are not in flight.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of sequence numbers in flight.
+ */
+static uint32_t _pipe(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t pipe = 0;
+    for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+        if (!((tcb->rtx_sacked | tcb->rtx_lost) & (1UL << i))) {
+            pipe += _gnrc_tcp_pkt_get_seg_len(tcb->pkt_retransmit[i]);
+        }
+    }
+    return pipe;
+}
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE)
+/**
+ * @brief Checks if the congestion window is controlled by CongURE.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   true, if a CongURE state object is attached to @p tcb.
+ */
+static inline bool _has_congure(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->congure != NULL;
+}
+
+/**
+ * @brief Limits a number of bytes to the window range of CongURE.
+ *
+ * @param[in] size   Number of bytes.
+ *
+ * @returns   @p size, at most CONGURE_WND_SIZE_MAX.
+ */
+static congure_wnd_size_t _congure_size(uint32_t size)
+{
+    return (size < CONGURE_WND_SIZE_MAX) ? size : CONGURE_WND_SIZE_MAX;
+}
+
+/**
+ * @brief Estimates the time a reported segment was sent.
+ *
+ * Send times are not kept per segment, so this is one smoothed round trip
+ * time ago.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Estimated send time in milliseconds.
+ */
+static ztimer_now_t _congure_send_time(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t now = evtimer_now_msec();
+
+    return (tcb->srtt > 0) ? now - tcb->srtt : now;
+}
+
+/**
+ * @brief Initializes the CongURE state object of an established connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->congure->driver->init(tcb->congure, tcb);
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+    /* The constants only know CONFIG_GNRC_TCP_MSS, the peer may announce less */
+    _gnrc_tcp_congure_reno_set_mss(tcb->congure, _smss(tcb));
+#endif
+    tcb->congure_flight = 0;
+    tcb->cwnd = tcb->congure->cwnd;
+}
+
+/**
+ * @brief Reports a sent segment to CongURE.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     len   Number of sequence numbers sent.
+ */
+static void _congure_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    congure_snd_t *c = tcb->congure;
+    uint32_t flight = tcb->congure_flight + len;
+
+    c->driver->report_msg_sent(c, _congure_size(len));
+
+    /* Implementations might cap their flight size at the congestion window.
+     * Track the smaller value to never report more bytes acknowledged or
+     * lost than the implementation considers in flight. */
+    tcb->congure_flight = (flight < c->cwnd) ? flight : c->cwnd;
+}
+
+/**
+ * @brief Reports an acknowledgement of new data to CongURE.
+ *
+ * @param[in,out] tcb         TCB holding the connection information.
+ * @param[in]     acked       Number of newly acknowledged sequence numbers.
+ * @param[in]     send_time   Time the acknowledged data was sent.
+ * @param[in]     resends     Number of retransmissions of the acknowledged data.
+ * @param[in]     seg_ack     Acknowledgement number of the incoming segment.
+ * @param[in]     seg_wnd     Window of the incoming segment.
+ * @param[in]     pay_len     Payload length of the incoming segment.
+ * @param[in]     ctl         Control bits of the incoming segment.
+ */
+static void _congure_acked(gnrc_tcp_tcb_t *tcb, uint32_t acked, ztimer_now_t send_time,
+                           uint8_t resends, uint32_t seg_ack, uint32_t seg_wnd,
+                           uint16_t pay_len, uint16_t ctl)
+{
+    congure_snd_t *c = tcb->congure;
+    congure_snd_msg_t msg = {
+        .send_time = send_time,
+        .size = (acked < tcb->congure_flight) ? acked : tcb->congure_flight,
+        .resends = resends,
+    };
+    /* Use IDs relative to the ISS: Implementations might compare them with
+     * an initial ID */
+    congure_snd_ack_t ack = {
+        .recv_time = evtimer_now_msec(),
+        .id = seg_ack - tcb->iss,
+        .size = _congure_size(pay_len),
+        .wnd = _congure_size(seg_wnd),
+        .clean = !(ctl & (MSK_SYN | MSK_FIN)),
+    };
+
+    c->driver->report_msg_acked(c, &msg, &ack);
+    tcb->congure_flight -= msg.size;
+    tcb->cwnd = c->cwnd;
+}
+
+/**
+ * @brief Reports lost or timed out data to CongURE.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     len       Number of sequence numbers lost.
+ * @param[in]     timeout   true, if the loss was detected by the retransmission timer.
+ */
+static void _congure_lost(gnrc_tcp_tcb_t *tcb, uint32_t len, bool timeout)
+{
+    congure_snd_t *c = tcb->congure;
+    congure_snd_msg_t msg = {
+        .send_time = _congure_send_time(tcb),
+        .size = (len < tcb->congure_flight) ? len : tcb->congure_flight,
+        .resends = tcb->retries,
+    };
+
+    /* Report the lost segments as a single message */
+    msg.super.next = &msg.super;
+    if (timeout) {
+        c->driver->report_msgs_timeout(c, &msg);
+    }
+    else {
+        c->driver->report_msgs_lost(c, &msg);
+    }
+    tcb->congure_flight -= msg.size;
+    tcb->cwnd = c->cwnd;
+}
+#else
+static inline bool _has_congure(const gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return false;
+}
+
+static inline uint32_t _congure_send_time(const gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+    return 0;
+}
+
+static inline void _congure_init(gnrc_tcp_tcb_t *tcb)
+{
+    (void)tcb;
+}
+
+static inline void _congure_sent(gnrc_tcp_tcb_t *tcb, uint32_t len)
+{
+    (void)tcb;
+    (void)len;
+}
+
+static inline void _congure_acked(gnrc_tcp_tcb_t *tcb, uint32_t acked, uint32_t send_time,
+                                  uint8_t resends, uint32_t seg_ack, uint32_t seg_wnd,
+                                  uint16_t pay_len, uint16_t ctl)
+{
+    (void)tcb;
+    (void)acked;
+    (void)send_time;
+    (void)resends;
+    (void)seg_ack;
+    (void)seg_wnd;
+    (void)pay_len;
+    (void)ctl;
+}
+
+static inline void _congure_lost(gnrc_tcp_tcb_t *tcb, uint32_t len, bool timeout)
+{
+    (void)tcb;
+    (void)len;
+    (void)timeout;
+}
+#endif
+
+/**
+ * @brief Initializes congestion control of an established connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _smss(tcb);
+
+    /* Initial window (RFC 5681, section 3.1) */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = UINT32_MAX;
+    tcb->recover = tcb->iss;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+
+    if (_has_congure(tcb)) {
+        _congure_init(tcb);
+    }
+}
+
+/**
+ * @brief Enters fast recovery (RFC 5681, section 3.2 and RFC 6582, section 3.2).
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _cc_enter_recovery(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _smss(tcb);
+    uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+    tcb->ssthresh = (flight / 2 > 2 * smss) ? flight / 2 : 2 * smss;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_FAST_RECOVERY;
+    tcb->rtx_resent = 0;
+
+    /* The oldest segment is lost. With SACK, so is every segment below a
+     * selectively acknowledged one */
+    tcb->rtx_lost = 1;
+    if (tcb->rtx_sacked) {
+        tcb->rtx_lost |= (1UL << bitarithm_msb(tcb->rtx_sacked)) - 1;
+    }
+    tcb->rtx_lost &= ~tcb->rtx_sacked;
+
+    if (_has_congure(tcb)) {
+        uint32_t lost = 0;
+        for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+            if (tcb->rtx_lost & (1UL << i)) {
+                lost += _gnrc_tcp_pkt_get_seg_len(tcb->pkt_retransmit[i]);
+            }
+        }
+        _congure_lost(tcb, lost, false);
+        return;
+    }
+
+    /* Without SACK, inflate the window by the segments that left the network */
+    tcb->cwnd = tcb->ssthresh;
+    if (!(tcb->status & STATUS_SACK_OK)) {
+        tcb->cwnd += tcb->dup_acks * smss;
+    }
+}
+
+/**
+ * @brief Congestion control on an acknowledgement of new data.
+ *
+ * With CongURE, only the loss recovery state is updated here.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged sequence numbers.
+ */
+static void _cc_new_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = _smss(tcb);
+
+    tcb->dup_acks = 0;
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Full acknowledgement: Deflate the window and leave fast recovery */
+        if (LEQ_32_BIT(tcb->recover, tcb->snd_una)) {
+            if (!_has_congure(tcb)) {
+                tcb->cwnd = tcb->ssthresh;
+            }
+            tcb->rtx_lost = 0;
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+        }
+        /* Partial acknowledgement: The next segment was lost as well */
+        else {
+            if (!((tcb->rtx_resent | tcb->rtx_sacked) & 1)) {
+                tcb->rtx_lost |= 1;
+            }
+            if (!(tcb->status & STATUS_SACK_OK) && !_has_congure(tcb)) {
+                tcb->cwnd = (tcb->cwnd > acked) ? tcb->cwnd - acked : 0;
+                if (acked >= smss) {
+                    tcb->cwnd += smss;
+                }
+            }
+        }
+    }
+    else if (_has_congure(tcb)) {
+        return;
+    }
+    /* Slow start */
+    else if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+    }
+    /* Congestion avoidance: Grow by about one SMSS per round trip */
+    else {
+        uint32_t inc = smss * smss / tcb->cwnd;
+        tcb->cwnd += (inc > 0) ? inc : 1;
+    }
+}
+
+/**
+ * @brief Congestion control on a duplicate acknowledgement.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _cc_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    uint8_t thresh = DUPACK_THRESHOLD;
+
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks += 1;
+    }
+
+    /* Without SACK, every duplicate ACK signals a segment that left the network */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        if (!(tcb->status & STATUS_SACK_OK) && !_has_congure(tcb)) {
+            tcb->cwnd += _smss(tcb);
+        }
+        return;
+    }
+
+    /* Early retransmit (RFC 5827): With only a few segments in flight, there
+     * are not enough duplicate ACKs to reach the threshold */
+    if (tcb->rtx_len >= 2 && tcb->rtx_len - 1 < thresh) {
+        thresh = tcb->rtx_len - 1;
+    }
+
+    /* Reduce the window only once per window of data (RFC 6582, section 4.1) */
+    if ((tcb->dup_acks >= thresh || bitarithm_bits_set_u32(tcb->rtx_sacked) >= thresh) &&
+        LSS_32_BIT(tcb->recover, tcb->snd_una)) {
+        _cc_enter_recovery(tcb);
+    }
+}
+
+/**
+ * @brief Retransmits segments considered lost, as far as the congestion window allows.
+ *
+ * The oldest segment is retransmitted regardless of the congestion window.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_lost(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t pipe = _pipe(tcb);
+
+    for (uint8_t i = 0; i < tcb->rtx_len && tcb->rtx_lost; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+        uint32_t mask = (1UL << i);
+        uint32_t len = 0;
+
+        if (!(tcb->rtx_lost & mask)) {
+            continue;
+        }
+        len = _gnrc_tcp_pkt_get_seg_len(pkt);
+        if (i > 0 && pipe + len > tcb->cwnd) {
+            break;
+        }
+        tcb->rtx_lost &= ~mask;
+        tcb->rtx_resent |= mask;
+        pipe += len;
+        if (_has_congure(tcb)) {
+            _congure_sent(tcb, len);
+        }
+
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(pkt, 1);
+        _gnrc_tcp_pkt_send(tcb, pkt, 0, true);
+    }
+}
+
+/**
+ * @brief Removes a block of out-of-order data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     idx   Index of the block in tcb->rcv_sack.
+ */
+static void _rcv_sack_remove(gnrc_tcp_tcb_t *tcb, uint8_t idx)
+{
+    tcb->rcv_sack_len -= 1;
+    memmove(&tcb->rcv_sack[idx], &tcb->rcv_sack[idx + 1],
+            (tcb->rcv_sack_len - idx) * sizeof(tcb->rcv_sack[0]));
+}
+
+/**
+ * @brief Adds a block of out-of-order data, merging it with existing blocks.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     left    First sequence number of the block.
+ * @param[in]     right   Sequence number following the block.
+ */
+static void _rcv_sack_add(gnrc_tcp_tcb_t *tcb, uint32_t left, uint32_t right)
+{
+    uint8_t i = 0;
+
+    while (i < tcb->rcv_sack_len) {
+        gnrc_tcp_sack_block_t *blk = &tcb->rcv_sack[i];
+
+        if (LEQ_32_BIT(blk->left, right) && LEQ_32_BIT(left, blk->right)) {
+            left = LSS_32_BIT(blk->left, left) ? blk->left : left;
+            right = LSS_32_BIT(right, blk->right) ? blk->right : right;
+            _rcv_sack_remove(tcb, i);
+        }
+        else {
+            i++;
+        }
+    }
+
+    /* The most recent block is reported first (RFC 2018, section 4).
+     * If all blocks are used, the oldest one is forgotten and its data is
+     * received again. */
+    if (tcb->rcv_sack_len == CONFIG_GNRC_TCP_SACK_BLOCKS) {
+        tcb->rcv_sack_len -= 1;
+    }
+    memmove(&tcb->rcv_sack[1], &tcb->rcv_sack[0],
+            tcb->rcv_sack_len * sizeof(tcb->rcv_sack[0]));
+    tcb->rcv_sack[0].left = left;
+    tcb->rcv_sack[0].right = right;
+    tcb->rcv_sack_len += 1;
+}
+
+/**
+ * @brief Copies the payload of a segment into the receive buffer.
+ *
+ * In-order data is made readable along with all out-of-order data it connects
+ * to. Out-of-order data is kept at its position in the receive window until
+ * the gap in front of it is filled.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     snp       First snip of the payload.
+ * @param[in]     seg_seq   Sequence number of the segment.
+ */
+static void _rcv_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *snp, uint32_t seg_seq)
+{
+    uint32_t skip = 0;
+    uint32_t offset = seg_seq - tcb->rcv_nxt;
+    uint32_t copied = 0;
+
+    /* Skip data that has been received already */
+    if (LSS_32_BIT(seg_seq, tcb->rcv_nxt)) {
+        skip = tcb->rcv_nxt - seg_seq;
+        offset = 0;
+    }
+
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (skip >= snp->size) {
+            skip -= snp->size;
+        }
+        else {
+            size_t len = snp->size - skip;
+            size_t res = _gnrc_tcp_rcvbuf_write(tcb, offset + copied,
+                                                (uint8_t *)snp->data + skip, len);
+            copied += res;
+            skip = 0;
+            if (res < len) {
+                break;
+            }
+        }
+        snp = snp->next;
+    }
+
+    if (copied == 0) {
+        return;
+    }
+
+    if (offset > 0) {
+        _rcv_sack_add(tcb, tcb->rcv_nxt + offset, tcb->rcv_nxt + offset + copied);
+        return;
+    }
+
+    _gnrc_tcp_rcvbuf_commit(tcb, copied);
+    tcb->rcv_nxt += copied;
+
+    /* Make out-of-order data readable that is no longer preceded by a gap */
+    uint8_t i = 0;
+    while (i < tcb->rcv_sack_len) {
+        gnrc_tcp_sack_block_t *blk = &tcb->rcv_sack[i];
+
+        if (LSS_32_BIT(tcb->rcv_nxt, blk->left)) {
+            i++;
+            continue;
+        }
+        if (LSS_32_BIT(tcb->rcv_nxt, blk->right)) {
+            _gnrc_tcp_rcvbuf_commit(tcb, blk->right - tcb->rcv_nxt);
+            tcb->rcv_nxt = blk->right;
+        }
+        _rcv_sack_remove(tcb, i);
+        i = 0;
+    }
+
+    /* Notify owner because new data is available */
+    tcb->status |= STATUS_NOTIFY_USER;
+}
+
+/**
+ * @brief Handles the TCP Fast Open option of a SYN+ACK.
+ *
+ * The cookie handed out by the peer is cached for the next connection. Data
+ * sent along with the SYN that the peer did not acknowledge is dropped from
+ * the retransmission queue, it is up to the user to send it again.
+ *
+ * @param[in,out] tcb          TCB holding the connection information.
+ * @param[in]     cookie       Cookie of the TCP Fast Open option.
+ * @param[in]     cookie_len   Length of @p cookie, -1 if the option was missing.
+ */
+static void _fastopen_rcvd_syn_ack(gnrc_tcp_tcb_t *tcb, const uint8_t *cookie,
+                                   int8_t cookie_len)
+{
+    if (cookie_len > 0) {
+        _gnrc_tcp_fastopen_cache_set(tcb, cookie, cookie_len);
+    }
+    if (tcb->snd_una != tcb->snd_nxt) {
+        /* A peer that stopped supporting TCP Fast Open ignores the data every time */
+        if (cookie_len < 0) {
+            _gnrc_tcp_fastopen_cache_del(tcb);
+        }
+        _clear_retransmit(tcb);
+        tcb->snd_nxt = tcb->snd_una;
+        tcb->status &= ~STATUS_RTT_PENDING;
+    }
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -150,6 +732,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
         case FSM_STATE_CLOSED:
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
+            _gnrc_tcp_rcvbuf_autotune_stop(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -175,7 +758,14 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
         case FSM_STATE_LISTEN:
             /* Clear Accepted Status */
-            tcb->status &= ~(STATUS_ACCEPTED);
+            tcb->status &= ~(STATUS_ACCEPTED | STATUS_FASTOPEN);
+            _gnrc_tcp_rcvbuf_autotune_stop(tcb);
+
+            /* Drop data accepted from the SYN of a reset connection attempt */
+            if (IS_USED(MODULE_GNRC_TCP_FASTOPEN) && tcb->rcv_buf_raw != NULL) {
+                ringbuffer_remove(&(tcb->rcv_buf), tcb->rcv_buf.avail);
+                tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+            }
 
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
@@ -237,6 +827,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             if (tcb->status & STATUS_LISTENING) {
                 _gnrc_tcp_eventloop_unsched(&tcb->event_timeout);
             }
+            /* Start congestion control of a new connection */
+            if (state == FSM_STATE_ESTABLISHED && tcb->state != FSM_STATE_ESTABLISHED) {
+                _cc_init(tcb);
+                tcb->rcv_sack_len = 0;
+            }
             tcb->status |= STATUS_NOTIFY_USER;
             break;
 
@@ -256,12 +851,15 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
  * @brief FSM handling function for opening a TCP connection.
  *
  * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     buf   Data to send along with the SYN using TCP Fast Open.
+ *                      NULL to open the connection without TCP Fast Open.
+ * @param[in]     len   Number of bytes in @p buf.
  *
  * @returns   Zero on success.
  *            -ENOMEM if receive buffer could not be allocated.
  *            -EADDRINUSE if given local port number is already in use.
  */
-static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
+static int _fsm_call_open(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
     int ret = 0;
@@ -273,7 +871,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         return -ENOMEM;
     }
 
-    tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
 
     if (tcb->status & STATUS_LISTENING) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -293,11 +891,25 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
             return ret;
         }
 
+        /* Request a TCP Fast Open cookie, or send data if one is cached */
+        size_t syn_len = 0;
+        tcb->status &= ~STATUS_FASTOPEN;
+        if (IS_USED(MODULE_GNRC_TCP_FASTOPEN) && buf != NULL) {
+            uint8_t cookie[TCP_OPTION_LENGTH_TFO_COOKIE_MAX];
+            uint16_t mss = CONFIG_GNRC_TCP_MSS;
+
+            tcb->status |= STATUS_FASTOPEN;
+            if (_gnrc_tcp_fastopen_cache_get(tcb, cookie, &mss) > 0) {
+                syn_len = (mss < CONFIG_GNRC_TCP_MSS) ? mss : CONFIG_GNRC_TCP_MSS;
+                syn_len = (len < syn_len) ? len : syn_len;
+            }
+        }
+
         /* Send SYN */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN, tcb->iss, 0,
-                            NULL, 0);
+                            buf, syn_len);
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
@@ -305,39 +917,195 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     return ret;
 }
 
+/**
+ * @brief Copies payload from an iolist into a new packet snip.
+ *
+ * @param[in] iol      Data to copy from.
+ * @param[in] offset   Number of bytes in @p iol to skip.
+ * @param[in] len      Number of bytes to copy.
+ *
+ * @returns   The new packet snip.
+ *            NULL if the packet buffer is full.
+ */
+static gnrc_pktsnip_t *_payload_copy(const iolist_t *iol, size_t offset, size_t len)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktbuf_add(NULL, NULL, len, GNRC_NETTYPE_UNDEF);
+    if (snp == NULL) {
+        return NULL;
+    }
+
+    uint8_t *dst = snp->data;
+    for (; iol != NULL && len > 0; iol = iol->iol_next) {
+        if (offset >= iol->iol_len) {
+            offset -= iol->iol_len;
+            continue;
+        }
+        size_t n = iol->iol_len - offset;
+        n = (n < len) ? n : len;
+        memcpy(dst, (uint8_t *)iol->iol_base + offset, n);
+        dst += n;
+        len -= n;
+        offset = 0;
+    }
+    return snp;
+}
+
+/**
+ * @brief Detaches the leading payload from a packet without copying it.
+ *
+ * The snip holding the end of the detached payload is split if necessary.
+ *
+ * @param[in,out] pkt   Payload to detach from, points to the remaining payload afterwards.
+ * @param[in]     len   Number of bytes to detach, must not exceed the size of @p pkt.
+ *
+ * @returns   The detached payload.
+ *            NULL if @p len is 0 or the packet buffer is full, @p pkt is left
+ *            untouched then.
+ */
+static gnrc_pktsnip_t *_payload_take(gnrc_pktsnip_t **pkt, size_t len)
+{
+    gnrc_pktsnip_t *head = *pkt;
+    gnrc_pktsnip_t *last = NULL;
+    gnrc_pktsnip_t *snp = *pkt;
+
+    if (len == 0 || head == NULL) {
+        return NULL;
+    }
+    while (snp != NULL && len >= snp->size) {
+        len -= snp->size;
+        last = snp;
+        snp = snp->next;
+    }
+    if (len > 0) {
+        /* Split snip: part holds the first len bytes, snp keeps the rest */
+        gnrc_pktsnip_t *part = gnrc_pktbuf_mark(snp, len, GNRC_NETTYPE_UNDEF);
+        if (part == NULL) {
+            return NULL;
+        }
+        snp->next = part->next;
+        part->next = NULL;
+        if (last != NULL) {
+            last->next = part;
+        }
+        else {
+            head = part;
+        }
+    }
+    else {
+        /* len was > 0, so at least one snip was consumed */
+        assert(last != NULL);
+        last->next = NULL;
+    }
+    *pkt = snp;
+    return head;
+}
+
+/**
+ * @brief Puts payload detached with _payload_take() back in front of a packet.
+ *
+ * @param[in,out] pkt    Remaining payload, points to the whole payload afterwards.
+ * @param[in]     head   Detached payload.
+ */
+static void _payload_return(gnrc_pktsnip_t **pkt, gnrc_pktsnip_t *head)
+{
+    gnrc_pktsnip_t *last = head;
+
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    last->next = *pkt;
+    *pkt = head;
+}
+
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Either @p iol or @p pkt holds the data to send. Data from @p iol is copied
+ * into the packet buffer, data in @p pkt is sent without copying it.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
- * @param[in,out] buf   Buffer containing data to send.
- * @param[in]     len   Maximum Number of Bytes to send from @p buf.
+ * @param[in]     iol   Data to send, NULL if @p pkt is used.
+ * @param[in,out] pkt   Data to send, NULL if @p iol is used. Points to the
+ *                      unsent remainder afterwards.
+ * @param[in]     len   Maximum Number of Bytes to send.
  *
  * @returns   Number of successfully transmitted bytes.
  */
-static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
+static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, const iolist_t *iol, gnrc_pktsnip_t **pkt,
+                          size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    uint32_t smss = _smss(tcb);
+    uint32_t pipe = _pipe(tcb);
+    size_t sent = 0;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Send segments while the windows are open and the retransmit queue has room */
+    while (sent < len && tcb->rtx_len < CONFIG_GNRC_TCP_RTX_QUEUE_SIZE &&
+           LSS_32_BIT(tcb->snd_nxt, tcb->snd_una + tcb->snd_wnd) && pipe < tcb->cwnd) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+        payload = (payload < tcb->cwnd - pipe) ? payload : tcb->cwnd - pipe;
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < len - sent) ? payload : len - sent;
+
+        /* Avoid the silly window syndrome: Send a small segment only if it
+         * contains the remaining data or nothing is in flight */
+        if (payload < smss && payload < len - sent && tcb->snd_una != tcb->snd_nxt) {
+            break;
+        }
+
+        /* Build segment around the payload */
+        gnrc_pktsnip_t *pay_snp = (pkt != NULL) ? _payload_take(pkt, payload)
+                                                : _payload_copy(iol, sent, payload);
+        if (pay_snp == NULL) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build_snip(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt,
+                                     tcb->rcv_nxt, pay_snp) < 0) {
+            if (pkt != NULL) {
+                _payload_return(pkt, pay_snp);
+            }
+            else {
+                gnrc_pktbuf_release(pay_snp);
+            }
+            break;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        if (_has_congure(tcb)) {
+            _congure_sent(tcb, seq_con);
+        }
+        sent += payload;
+        pipe += seq_con;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
+}
+
+/**
+ * @brief Reopens the receive window after data was read or the receive buffer was resized.
+ *
+ * A window update is sent if the window grew and can take at least CONFIG_GNRC_TCP_MSS.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _open_rcv_wnd(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = _gnrc_tcp_rcvbuf_get_window(tcb, tcb->rcv_nxt + tcb->rcv_wnd);
+
+    if (wnd > tcb->rcv_wnd && wnd >= CONFIG_GNRC_TCP_MSS) {
+        tcb->rcv_wnd = wnd;
+
+        /* Send ACK to announce window update */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                            tcb->rcv_nxt, NULL, 0);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+    }
 }
 
 /**
@@ -354,6 +1122,9 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     TCP_DEBUG_ENTER;
 
     if (ringbuffer_empty(&tcb->rcv_buf)) {
+        /* Let the receive buffer of an idle connection shrink */
+        _gnrc_tcp_rcvbuf_autotune(tcb, 0);
+        _open_rcv_wnd(tcb);
         TCP_DEBUG_LEAVE;
         return 0;
     }
@@ -361,17 +1132,9 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
 
-    /* If receive buffer can store more than CONFIG_GNRC_TCP_MSS: set window to free buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= CONFIG_GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-
-        /* Send ACK to announce window update */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-    }
+    /* Adapt the receive buffer to the rate data is read at */
+    _gnrc_tcp_rcvbuf_autotune(tcb, rcvd);
+    _open_rcv_wnd(tcb);
     TCP_DEBUG_LEAVE;
     return rcvd;
 }
@@ -463,13 +1226,17 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_seq = 0;            /* Sequence number of the incoming packet*/
     uint32_t seg_ack = 0;            /* Acknowledgment number of the incoming packet */
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
+    gnrc_tcp_sack_block_t sack[TCP_OPTION_SACK_BLOCKS_MAX]; /* Blocks of the SACK option */
+    uint8_t sack_len = 0;            /* Number of blocks in the SACK option */
+    uint8_t cookie[TCP_OPTION_LENGTH_TFO_COOKIE_MAX]; /* Cookie of the TFO option */
+    int8_t cookie_len = -1;          /* Length of the cookie, -1 without TFO option */
 
     /* Search for TCP header. */
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
+    if (_gnrc_tcp_option_parse(tcb, tcp_hdr, sack, &sack_len, cookie, &cookie_len) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
         TCP_DEBUG_LEAVE;
         return 0;
@@ -481,6 +1248,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* The window field of a SYN is never scaled (RFC 7323, section 2.2) */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wnd_scale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
@@ -574,6 +1346,19 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_nxt = tcb->iss;
             tcb->snd_wnd = seg_wnd;
 
+            /* TCP Fast Open: Hand out a cookie, accept the data if the cookie is valid.
+             * Only done if the application enabled it for this listener. */
+            if (IS_USED(MODULE_GNRC_TCP_FASTOPEN) && (tcb->status & STATUS_FASTOPEN_LISTEN) &&
+                cookie_len >= 0) {
+                tcb->status |= STATUS_FASTOPEN;
+                if (cookie_len > 0 && _gnrc_tcp_fastopen_cookie_valid(tcb, cookie, cookie_len)) {
+                    tcb->rcv_sack_len = 0;
+                    snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
+                    _rcv_payload(tcb, snp, tcb->rcv_nxt);
+                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                }
+            }
+
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
                                 tcb->rcv_nxt, NULL, 0);
@@ -616,6 +1401,9 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
                 _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                if (IS_USED(MODULE_GNRC_TCP_FASTOPEN) && (tcb->status & STATUS_FASTOPEN)) {
+                    _fastopen_rcvd_syn_ack(tcb, cookie, cookie_len);
+                }
             }
             /* Set local network layer address accordingly */
 #ifdef MODULE_GNRC_IPV6
@@ -712,8 +1500,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+                    uint8_t resends = tcb->retries;
+                    uint32_t send_time = _congure_send_time(tcb);
+
+                    /* An RTT measurement completed by this ACK tells the exact send time */
+                    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, seg_ack)) {
+                        send_time = tcb->rtt_start;
+                    }
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_pkt_sack(tcb, sack, sack_len);
+                    _cc_new_ack(tcb, acked);
+                    if (_has_congure(tcb)) {
+                        _congure_acked(tcb, acked, send_time, resends, seg_ack, seg_wnd,
+                                       pay_len, ctl);
+                    }
+
+                    /* Signal user that the retransmit queue has room again */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -723,6 +1528,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     TCP_DEBUG_LEAVE;
                     return 0;
                 }
+                /* Duplicate ACK: Data was received after a lost segment (RFC 5681, section 2) */
+                else if (seg_ack == tcb->snd_una && tcb->rtx_len > 0 && pay_len == 0 &&
+                         !(ctl & MSK_FIN) && seg_wnd == tcb->snd_wnd) {
+                    _gnrc_tcp_pkt_sack(tcb, sack, sack_len);
+                    _cc_dup_ack(tcb);
+
+                    /* Signal user, the congestion window might have grown */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
                 /* Update receive window */
                 if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
@@ -735,28 +1549,31 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->status |= STATUS_NOTIFY_USER;
                     }
                 }
+                /* Retransmit segments considered lost */
+                _send_lost(tcb);
+
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -773,23 +1590,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
                 /* Search for begin of payload */
+                uint32_t r_edge = tcb->rcv_nxt + tcb->rcv_wnd;
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
+                _rcv_payload(tcb, snp, seg_seq);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-                    /* Notify owner because new data is available */
-                    tcb->status |= STATUS_NOTIFY_USER;
-                }
-                /* Send ACK, if FIN processing sends ACK already */
+                /* Shrink receive window */
+                tcb->rcv_wnd = _gnrc_tcp_rcvbuf_get_window(tcb, r_edge);
+
+                /* Send ACK, if FIN processing doesn't send ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -803,6 +1613,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Process FIN only if all data in front of it was received */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                if (pay_len == 0) {
+                    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                        tcb->rcv_nxt, NULL, 0);
+                    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                }
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +1633,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +1677,35 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        uint32_t smss = _smss(tcb);
+        uint32_t flight = tcb->snd_nxt - tcb->snd_una;
+
+        if (_has_congure(tcb)) {
+            _congure_lost(tcb, flight, true);
+        }
+        else {
+            /* Reduce slow start threshold on the first timeout (RFC 5681, section 3.1) */
+            if (tcb->retries == 0) {
+                tcb->ssthresh = (flight / 2 > 2 * smss) ? flight / 2 : 2 * smss;
+            }
+            tcb->cwnd = smss;
+        }
+        tcb->recover = tcb->snd_nxt;
+        tcb->dup_acks = 0;
+        tcb->status &= ~STATUS_FAST_RECOVERY;
+
+        /* The receiver might have dropped selectively acknowledged data
+         * (RFC 2018, section 8): Send all segments again, oldest first */
+        tcb->rtx_sacked = 0;
+        tcb->rtx_resent = 0;
+        tcb->rtx_lost = (UINT32_MAX >> (32 - tcb->rtx_len)) & ~1UL;
+
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
+        if (_has_congure(tcb)) {
+            _congure_sent(tcb, _gnrc_tcp_pkt_get_seg_len(tcb->pkt_retransmit[0]));
+        }
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -883,6 +1729,28 @@ static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief FSM handling function for the receive buffer autotuning timer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   Zero on success.
+ */
+static int _fsm_timeout_rcvbuf(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    tcb->status &= ~STATUS_RCVBUF_TIMER;
+
+    /* Autotune while the peer may send data, this rearms the timer */
+    if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
+        tcb->state == FSM_STATE_FIN_WAIT_2) {
+        _gnrc_tcp_rcvbuf_autotune(tcb, 0);
+        _open_rcv_wnd(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 /**
  * @brief FSM handling function for probe sending.
  *
@@ -941,10 +1809,13 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
 
     switch (event) {
         case FSM_EVENT_CALL_OPEN :
-            ret = _fsm_call_open(tcb);
+            ret = _fsm_call_open(tcb, buf, len);
             break;
         case FSM_EVENT_CALL_SEND :
-            ret = _fsm_call_send(tcb, buf, len);
+            ret = _fsm_call_send(tcb, buf, NULL, len);
+            break;
+        case FSM_EVENT_CALL_SEND_PKT :
+            ret = _fsm_call_send(tcb, NULL, buf, len);
             break;
         case FSM_EVENT_CALL_RECV :
             ret = _fsm_call_recv(tcb, buf, len);
@@ -967,6 +1838,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_TIMEOUT_CONNECTION :
             ret = _fsm_timeout_connection(tcb);
             break;
+        case FSM_EVENT_TIMEOUT_RCVBUF :
+            ret = _fsm_timeout_rcvbuf(tcb);
+            break;
         case FSM_EVENT_SEND_PROBE :
             ret = _fsm_send_probe(tcb);
             break;
@@ -16,17 +16,36 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <string.h>
+
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr,
+                           gnrc_tcp_sack_block_t *sack, uint8_t *sack_len,
+                           uint8_t *cookie, int8_t *cookie_len)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    /* Window scaling and SACK are negotiated during connection setup only. */
+    /* The options must be absent in the SYN to disable them. */
+    bool negotiate = (ctl & MSK_SYN) && (tcb->state == FSM_STATE_LISTEN ||
+                                         tcb->state == FSM_STATE_SYN_SENT);
+    if (negotiate) {
+        tcb->status &= ~(STATUS_SACK_OK | STATUS_WND_SCALE);
+        tcb->snd_wnd_scale = 0;
+        tcb->rcv_wnd_scale = 0;
+    }
+    *sack_len = 0;
+    *cookie_len = -1;
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +83,70 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid WS option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("WS option found.");
+                if (negotiate) {
+                    tcb->status |= STATUS_WND_SCALE;
+                    tcb->snd_wnd_scale = (option->value[0] < TCP_OPTION_WS_SHIFT_MAX)
+                                       ? option->value[0] : TCP_OPTION_WS_SHIFT_MAX;
+                    tcb->rcv_wnd_scale = _gnrc_tcp_option_get_rcv_wnd_scale();
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (negotiate) {
+                    tcb->status |= STATUS_SACK_OK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                for (uint8_t *blk = option->value; blk < opt_ptr + option->length;
+                     blk += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    if (*sack_len < TCP_OPTION_SACK_BLOCKS_MAX) {
+                        sack[*sack_len].left = byteorder_bebuftohl(blk);
+                        sack[*sack_len].right = byteorder_bebuftohl(blk + 4);
+                        *sack_len += 1;
+                    }
+                }
+                break;
+
+            case TCP_OPTION_KIND_TFO:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    (option->length != TCP_OPTION_LENGTH_MIN &&
+                     (option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_TFO_COOKIE_MIN ||
+                      option->length > TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_TFO_COOKIE_MAX))) {
+                    TCP_DEBUG_ERROR("Invalid TFO option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("TFO option found.");
+                if (ctl & MSK_SYN) {
+                    *cookie_len = option->length - TCP_OPTION_LENGTH_MIN;
+                    memcpy(cookie, option->value, *cookie_len);
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
@@ -19,6 +19,7 @@
 #include <string.h>
 #include <utlist.h>
 #include <errno.h>
+#include "assert.h"
 #include "byteorder.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
@@ -26,6 +27,7 @@
 #include "net/gnrc.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
+#include "include/gnrc_tcp_fastopen.h"
 #include "include/gnrc_tcp_option.h"
 #include "include/gnrc_tcp_pkt.h"
 
@@ -36,6 +38,11 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert(CONFIG_GNRC_TCP_RTX_QUEUE_SIZE < 32,
+              "The retransmit queue is tracked in 32 bit masks");
+static_assert(CONFIG_GNRC_TCP_SACK_BLOCKS <= TCP_OPTION_SACK_BLOCKS_MAX,
+              "No more SACK blocks fit into the option field");
+
 /**
  * @brief Calculates the maximum of two unsigned numbers.
  *
@@ -49,6 +56,43 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the retransmission timeout from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If no RTT was measured yet: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else {
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+}
+
+/**
+ * @brief (Re-)starts the retransmission timer with the current RTO.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -145,6 +189,18 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
     return 0;
 }
 
+/**
+ * @brief Releases the headers of a packet, but not the payload following them.
+ *
+ * @param[in] pkt       First header of the packet.
+ * @param[in] tcp_snp   TCP header, the last header of the packet.
+ */
+static void _release_hdrs(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *tcp_snp)
+{
+    tcp_snp->next = NULL;
+    gnrc_pktbuf_release(pkt);
+}
+
 int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         uint16_t *seq_con, const uint16_t ctl,
                         const uint32_t seq_num, const uint32_t ack_num,
@@ -152,9 +208,6 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 {
     TCP_DEBUG_ENTER;
     gnrc_pktsnip_t *pay_snp = NULL;
-    gnrc_pktsnip_t *tcp_snp = NULL;
-    tcp_hdr_t tcp_hdr;
-    uint8_t offset = TCP_HDR_OFFSET_MIN;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -167,19 +220,72 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
         }
     }
 
+    int ret = _gnrc_tcp_pkt_build_snip(tcb, out_pkt, seq_con, ctl, seq_num, ack_num, pay_snp);
+    if (ret < 0 && pay_snp != NULL) {
+        gnrc_pktbuf_release(pay_snp);
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+int _gnrc_tcp_pkt_build_snip(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const uint16_t ctl,
+                             const uint32_t seq_num, const uint32_t ack_num,
+                             gnrc_pktsnip_t *pay_snp)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_pktsnip_t *tcp_snp = NULL;
+    tcp_hdr_t tcp_hdr;
+    uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint8_t sack_len = 0;
+    uint32_t wnd = tcb->rcv_wnd;
+    bool add_ws = false;
+    bool add_sack_perm = false;
+    uint8_t cookie[TCP_OPTION_LENGTH_TFO_COOKIE_MAX];
+    int8_t cookie_len = -1;
+
     /* Fill TCP header */
     tcp_hdr.src_port = byteorder_htons(tcb->local_port);
     tcp_hdr.dst_port = byteorder_htons(tcb->peer_port);
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
+    /* The window field of a SYN is never scaled (RFC 7323, section 2.2) */
+    if (!(ctl & MSK_SYN)) {
+        wnd >>= tcb->rcv_wnd_scale;
+    }
+    tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
+
     /* Calculate option field size. */
     /* Add MSS option if SYN is sent */
     if (ctl & MSK_SYN) {
         offset += 1;
+
+        /* Offer window scaling and SACK in a SYN, accept them in a SYN+ACK if offered */
+        add_ws = !(ctl & MSK_ACK) || (tcb->status & STATUS_WND_SCALE);
+        add_sack_perm = !(ctl & MSK_ACK) || (tcb->status & STATUS_SACK_OK);
+        offset += add_ws + add_sack_perm;
+
+        /* A client sends its cached cookie or requests one, a server hands one out */
+        if (IS_USED(MODULE_GNRC_TCP_FASTOPEN) && (tcb->status & STATUS_FASTOPEN)) {
+            if (ctl & MSK_ACK) {
+                _gnrc_tcp_fastopen_cookie_gen(tcb, cookie);
+                cookie_len = CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN;
+            }
+            else {
+                uint16_t mss;
+                cookie_len = _gnrc_tcp_fastopen_cache_get(tcb, cookie, &mss);
+            }
+            offset += 1 + (cookie_len + sizeof(network_uint32_t) - 1) / sizeof(network_uint32_t);
+        }
+    }
+    /* Report out-of-order data if SACK is used on this connection */
+    else if ((ctl & MSK_ACK) && !(ctl & MSK_RST) && (tcb->status & STATUS_SACK_OK) &&
+             tcb->rcv_sack_len > 0) {
+        sack_len = tcb->rcv_sack_len;
+        offset += 1 + sack_len * (TCP_OPTION_LENGTH_SACK_BLOCK / sizeof(network_uint32_t));
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -187,7 +293,6 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 
     tcp_snp = gnrc_pktbuf_add(pay_snp, &tcp_hdr, sizeof(tcp_hdr), GNRC_NETTYPE_TCP);
     if (tcp_snp == NULL) {
-        gnrc_pktbuf_release(pay_snp);
         *(out_pkt) = NULL;
         TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for TCP header.");
         TCP_DEBUG_LEAVE;
@@ -196,7 +301,7 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     else {
         /* Resize TCP header: size = offset * 4 bytes */
         if (gnrc_pktbuf_realloc_data(tcp_snp, offset * 4)) {
-            gnrc_pktbuf_release(tcp_snp);
+            _release_hdrs(tcp_snp, tcp_snp);
             *(out_pkt) = NULL;
             TCP_DEBUG_ERROR("-ENOMEM: Can't realloc buffer for TCP header.");
             TCP_DEBUG_LEAVE;
@@ -217,8 +322,43 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
                 memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                opt_ptr += sizeof(mss_option);
+            }
+            if (add_ws) {
+                network_uint32_t ws_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_ws(_gnrc_tcp_option_get_rcv_wnd_scale()));
+
+                memcpy(opt_ptr, &ws_option, sizeof(ws_option));
+                opt_ptr += sizeof(ws_option);
+            }
+            if (add_sack_perm) {
+                network_uint32_t sack_perm_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack_perm());
+
+                memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+                opt_ptr += sizeof(sack_perm_option);
+            }
+            if (sack_len > 0) {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_len));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (uint8_t i = 0; i < sack_len; i++) {
+                    byteorder_htobebufl(opt_ptr, tcb->rcv_sack[i].left);
+                    byteorder_htobebufl(opt_ptr + 4, tcb->rcv_sack[i].right);
+                    opt_ptr += TCP_OPTION_LENGTH_SACK_BLOCK;
+                }
+            }
+            if (cookie_len >= 0) {
+                network_uint32_t tfo_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_tfo(cookie_len));
+
+                memcpy(opt_ptr, &tfo_option, sizeof(tfo_option));
+                opt_ptr += sizeof(tfo_option);
+                memcpy(opt_ptr, cookie, cookie_len);
+                opt_ptr += cookie_len;
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -231,7 +371,7 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
 
     gnrc_pktsnip_t *ip6_snp = gnrc_ipv6_hdr_build(tcp_snp, src_addr, dst_addr);
     if (ip6_snp == NULL) {
-        gnrc_pktbuf_release(tcp_snp);
+        _release_hdrs(tcp_snp, tcp_snp);
         *(out_pkt) = NULL;
         TCP_DEBUG_ERROR("-ENOMEM: Can't allocate buffer for IPv6 header.");
         TCP_DEBUG_LEAVE;
@@ -245,7 +385,7 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     if (tcb->ll_iface > 0) {
         gnrc_pktsnip_t *net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
         if (net_snp == NULL) {
-            gnrc_pktbuf_release(ip6_snp);
+            _release_hdrs(ip6_snp, tcp_snp);
             *(out_pkt) = NULL;
             TCP_DEBUG_ERROR("-ENOMEM: Can't allocate buffer for netif header.");
             TCP_DEBUG_LEAVE;
@@ -269,7 +409,7 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
         if (ctl & MSK_FIN) {
             *seq_con += 1;
         }
-        *seq_con += payload_len;
+        *seq_con += gnrc_pkt_len(pay_snp);
     }
     TCP_DEBUG_LEAVE;
     return 0;
@@ -287,12 +427,18 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+
+        /* Time one segment per round trip */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
     }
     else {
-        tcb->retries += 1;
+        /* Karns Algorithm: Discard the measurement if anything is retransmitted */
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -391,13 +537,6 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
-        TCP_DEBUG_LEAVE;
-        return -ENOMEM;
-    }
-
     /* Extract control bits and segment length */
     snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
     if (snp == NULL) {
@@ -415,22 +554,30 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
-    gnrc_pktbuf_hold(pkt, 1);
-
-    /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        /* Check if retransmit queue is full */
+        if (tcb->rtx_len >= ARRAY_SIZE(tcb->pkt_retransmit)) {
+            TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
+            TCP_DEBUG_LEAVE;
+            return -ENOMEM;
         }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+
+        /* Append pkt and increase users: every send attempt consumes a user */
+        tcb->pkt_retransmit[tcb->rtx_len++] = pkt;
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* The timer is already running for an older segment */
+        if (tcb->rtx_len > 1) {
+            TCP_DEBUG_LEAVE;
+            return 0;
         }
+        _calc_rto(tcb);
     }
     else {
+        /* Timeouts only retransmit the oldest segment */
+        assert(tcb->rtx_len > 0 && tcb->pkt_retransmit[0] == pkt);
+        gnrc_pktbuf_hold(pkt, 1);
+
         /* If this is a retransmission: Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
@@ -440,19 +587,11 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
-    }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+        tcb->retries += 1;
     }
 
     /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    _sched_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -461,40 +600,60 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
     uint32_t seg = 0;
+    uint8_t acked = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
-        TCP_DEBUG_LEAVE;
-        return -EINVAL;
-    }
-
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    /* Release all segments that were acknowledged completely, oldest first */
+    while (acked < tcb->rtx_len) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[acked], GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            TCP_DEBUG_ERROR("snp == NULL.");
+            break;
+        }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[acked]) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[acked]);
+        acked++;
+    }
+
+    if (acked > 0) {
+        tcb->rtx_len -= acked;
+        memmove(tcb->pkt_retransmit, tcb->pkt_retransmit + acked,
+                tcb->rtx_len * sizeof(tcb->pkt_retransmit[0]));
+        if (tcb->rtx_len == 0) {
+            tcb->rtx_sacked = 0;
+            tcb->rtx_lost = 0;
+            tcb->rtx_resent = 0;
+        }
+        else {
+            tcb->rtx_sacked >>= acked;
+            tcb->rtx_lost >>= acked;
+            tcb->rtx_resent >>= acked;
+        }
+        tcb->retries = 0;
+    }
 
-        /* Measure round trip time */
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -509,10 +668,50 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Restart the timer for the remaining segments (RFC 6298, section 5.3) */
+    if (acked > 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+        if (tcb->rtx_len > 0) {
+            _calc_rto(tcb);
+            _sched_retransmit(tcb);
+        }
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_sack_block_t *sack,
+                        const uint8_t sack_len)
+{
+    TCP_DEBUG_ENTER;
+    for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+        uint32_t mask = (1UL << i);
+        if (tcb->rtx_sacked & mask) {
+            continue;
+        }
+
+        gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[i],
+                                                       GNRC_NETTYPE_TCP);
+        if (snp == NULL) {
+            continue;
+        }
+
+        uint32_t left = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+        uint32_t right = left + _gnrc_tcp_pkt_get_seg_len(tcb->pkt_retransmit[i]);
+
+        /* Mark segment if a block covers it completely */
+        for (uint8_t j = 0; j < sack_len; j++) {
+            if (LEQ_32_BIT(sack[j].left, left) && LEQ_32_BIT(right, sack[j].right)) {
+                tcb->rtx_sacked |= mask;
+                tcb->rtx_lost &= ~mask;
+                break;
+            }
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
@@ -18,27 +18,34 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "assert.h"
+#include "bitfield.h"
+#include "evtimer.h"
+#include "macros/math.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 /**
- * @brief Receive buffer entry.
+ * @brief Number of blocks in the receive buffer pool.
  */
-typedef struct {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} _rcvbuf_entry_t;
+#define RCVBUF_BLOCKS   DIV_ROUND_UP(CONFIG_GNRC_TCP_RCVBUF_POOL_SIZE, \
+                                     CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE)
 
 /**
- * @brief Struct holding receive buffers.
+ * @brief Struct holding the receive buffer pool.
+ *
+ * Each receive buffer occupies a contiguous run of blocks.
  */
 typedef struct {
-    mutex_t lock;                                         /**< Access lock */
-    _rcvbuf_entry_t entries[CONFIG_GNRC_TCP_RCV_BUFFERS]; /**< Buffers */
+    mutex_t lock;                                   /**< Access lock */
+    BITFIELD(used, RCVBUF_BLOCKS);                  /**< Flags: Is block in use? */
+    uint8_t pool[RCVBUF_BLOCKS * CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE]; /**< Pool storage */
 } _rcvbuf_t;
 
 /**
@@ -46,23 +53,90 @@ typedef struct {
  */
 static _rcvbuf_t _static_buf;
 
+/**
+ * @brief Clamps a receive buffer size to the configured limits.
+ *
+ * @param[in] size   Requested size in bytes.
+ *
+ * @returns   Size that is allowed, a multiple of the block size unless limited
+ *            by GNRC_TCP_RCV_BUF_SIZE.
+ */
+static size_t _rcvbuf_clamp(size_t size)
+{
+    if (size < CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE) {
+        size = CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE;
+    }
+    size = DIV_ROUND_UP(size, CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE) *
+           CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE;
+    if (size > GNRC_TCP_RCV_BUF_SIZE) {
+        size = GNRC_TCP_RCV_BUF_SIZE;
+    }
+    return size;
+}
+
+/**
+ * @brief Marks blocks of the pool as used or unused.
+ *
+ * @note Must be called with _static_buf.lock held.
+ *
+ * @param[in] first   Index of the first block.
+ * @param[in] num     Number of blocks.
+ * @param[in] used    Flag to set.
+ */
+static void _rcvbuf_mark(size_t first, size_t num, bool used)
+{
+    for (size_t i = first; i < first + num; ++i) {
+        if (used) {
+            bf_set(_static_buf.used, i);
+        }
+        else {
+            bf_unset(_static_buf.used, i);
+        }
+    }
+}
+
+/**
+ * @brief Searches the first run of unused blocks that is long enough.
+ *
+ * @note Must be called with _static_buf.lock held.
+ *
+ * @param[in] num   Number of blocks needed.
+ *
+ * @returns   Index of the first block of the run.
+ *            -1 if there is none.
+ */
+static int _rcvbuf_find(size_t num)
+{
+    size_t run = 0;
+
+    for (size_t i = 0; i < RCVBUF_BLOCKS; ++i) {
+        run = bf_isset(_static_buf.used, i) ? 0 : run + 1;
+        if (run == num) {
+            return i + 1 - num;
+        }
+    }
+    return -1;
+}
+
 /**
  * @brief Allocate receive buffer.
  *
+ * @param[in] size   Size of the buffer in bytes.
+ *
  * @returns   Not NULL if a receive buffer was allocated.
  *            NULL if allocation failed.
  */
-static void* _rcvbuf_alloc(void)
+static void* _rcvbuf_alloc(size_t size)
 {
     TCP_DEBUG_ENTER;
     void *result = NULL;
+    size_t num = DIV_ROUND_UP(size, CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE);
+
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if (_static_buf.entries[i].used == 0) {
-            _static_buf.entries[i].used = 1;
-            result = (void *)(_static_buf.entries[i].buffer);
-            break;
-        }
+    int first = _rcvbuf_find(num);
+    if (first >= 0) {
+        _rcvbuf_mark(first, num, true);
+        result = (void *)(&_static_buf.pool[first * CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE]);
     }
     mutex_unlock(&(_static_buf.lock));
     TCP_DEBUG_LEAVE;
@@ -72,28 +146,152 @@ static void* _rcvbuf_alloc(void)
 /**
  * @brief Release allocated receive buffer.
  *
- * @param[in] buf   Pointer to buffer that should be released.
+ * @param[in] buf    Pointer to buffer that should be released.
+ * @param[in] size   Size of the buffer in bytes.
  */
-static void _rcvbuf_free(void * const buf)
+static void _rcvbuf_free(void * const buf, size_t size)
 {
     TCP_DEBUG_ENTER;
+    size_t first = ((uint8_t *)buf - _static_buf.pool) / CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE;
+
     mutex_lock(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        if ((_static_buf.entries[i].used == 1) && (buf == _static_buf.entries[i].buffer)) {
-            _static_buf.entries[i].used = 0;
+    _rcvbuf_mark(first, DIV_ROUND_UP(size, CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE), false);
+    mutex_unlock(&(_static_buf.lock));
+    TCP_DEBUG_LEAVE;
+}
+
+/**
+ * @brief Reverses the order of bytes in a buffer.
+ *
+ * @param[in,out] buf   Buffer to reverse.
+ * @param[in]     len   Number of bytes in @p buf.
+ */
+static void _reverse(uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len / 2; ++i) {
+        uint8_t tmp = buf[i];
+        buf[i] = buf[len - i - 1];
+        buf[len - i - 1] = tmp;
+    }
+}
+
+/**
+ * @brief Get the number of bytes at the beginning of the receive buffer that are in use.
+ *
+ * Besides the readable data, this includes out-of-order data stored behind it.
+ *
+ * @param[in] tcb   TCB holding the receive buffer.
+ *
+ * @returns   Number of bytes in use.
+ */
+static size_t _rcvbuf_in_use(const gnrc_tcp_tcb_t *tcb)
+{
+    size_t len = tcb->rcv_buf.avail;
+
+    for (uint8_t i = 0; i < tcb->rcv_sack_len; ++i) {
+        size_t right = tcb->rcv_buf.avail + (tcb->rcv_sack[i].right - tcb->rcv_nxt);
+        if (right > len) {
+            len = right;
         }
     }
+    return len;
+}
+
+/**
+ * @brief Changes the size of the receive buffer, moving it within the pool if necessary.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     size   New size in bytes, must hold all data in use.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if the pool has no space for the new size.
+ */
+static int _rcvbuf_resize(gnrc_tcp_tcb_t *tcb, size_t size)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    size_t old_first = (tcb->rcv_buf_raw - _static_buf.pool) / CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE;
+    size_t old_num = DIV_ROUND_UP(rb->size, CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE);
+    size_t num = DIV_ROUND_UP(size, CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE);
+    size_t keep = _rcvbuf_in_use(tcb);
+
+    assert(keep <= size);
+
+    mutex_lock(&(_static_buf.lock));
+
+    /* Search space as if the buffer was released, this allows to grow in place */
+    _rcvbuf_mark(old_first, old_num, false);
+    int first = _rcvbuf_find(num);
+    if (first < 0) {
+        _rcvbuf_mark(old_first, old_num, true);
+        mutex_unlock(&(_static_buf.lock));
+        TCP_DEBUG_LEAVE;
+        return -ENOMEM;
+    }
+    _rcvbuf_mark(first, num, true);
+
+    /* Rotate data to the beginning of the buffer. The buffer must not be
+     * written by another connection until the data was moved. */
+    if (rb->start > 0) {
+        _reverse((uint8_t *)rb->buf, rb->start);
+        _reverse((uint8_t *)rb->buf + rb->start, rb->size - rb->start);
+        _reverse((uint8_t *)rb->buf, rb->size);
+        rb->start = 0;
+    }
+    tcb->rcv_buf_raw = &_static_buf.pool[first * CONFIG_GNRC_TCP_RCVBUF_BLOCK_SIZE];
+    memmove(tcb->rcv_buf_raw, rb->buf, keep);
     mutex_unlock(&(_static_buf.lock));
+
+    rb->buf = (char *)tcb->rcv_buf_raw;
+    rb->size = size;
     TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+/**
+ * @brief Shrinks the receive buffer to the pending size if that retracts no window.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+static void _rcvbuf_shrink(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->rcv_buf_shrink == 0 ||
+        tcb->rcv_buf.avail + tcb->rcv_wnd > tcb->rcv_buf_shrink) {
+        return;
+    }
+    if (_rcvbuf_resize(tcb, tcb->rcv_buf_shrink) == 0) {
+        tcb->rcv_buf_stats.shrunk += 1;
+    }
+    tcb->rcv_buf_shrink = 0;
+}
+
+/**
+ * @brief Arms the autotuning timer of a receive buffer that may shrink.
+ *
+ * The timer lets the receive buffer of a connection shrink if the user
+ * stopped reading. It runs once per retransmission timeout while the buffer
+ * is larger than its minimum size.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+static void _rcvbuf_timer_arm(gnrc_tcp_tcb_t *tcb)
+{
+    if ((tcb->status & STATUS_RCVBUF_TIMER) ||
+        tcb->rcv_buf.size <= _rcvbuf_clamp(CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE)) {
+        return;
+    }
+    tcb->status |= STATUS_RCVBUF_TIMER;
+    _gnrc_tcp_eventloop_sched(&tcb->event_rcvbuf,
+                              (tcb->rto > 0) ? (uint32_t)tcb->rto
+                                             : CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS,
+                              MSG_TYPE_RCVBUF, tcb);
 }
 
 void _gnrc_tcp_rcvbuf_init(void)
 {
     TCP_DEBUG_ENTER;
     mutex_init(&(_static_buf.lock));
-    for (size_t i = 0; i < CONFIG_GNRC_TCP_RCV_BUFFERS; ++i) {
-        _static_buf.entries[i].used = 0;
-    }
+    bf_clear_all(_static_buf.used, RCVBUF_BLOCKS);
     TCP_DEBUG_LEAVE;
 }
 
@@ -101,14 +299,25 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
     if (tcb->rcv_buf_raw == NULL) {
-        tcb->rcv_buf_raw = _rcvbuf_alloc();
+        /* Start with the default window, fall back to the minimum if the pool is crowded */
+        size_t size = _rcvbuf_clamp(CONFIG_GNRC_TCP_DEFAULT_WINDOW);
+        tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+        if (tcb->rcv_buf_raw == NULL) {
+            size = _rcvbuf_clamp(CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE);
+            tcb->rcv_buf_raw = _rcvbuf_alloc(size);
+        }
         if (tcb->rcv_buf_raw == NULL) {
             TCP_DEBUG_ERROR("-ENOMEM: Failed to allocate receive buffer.");
             TCP_DEBUG_LEAVE;
             return -ENOMEM;
         }
         else {
-            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, GNRC_TCP_RCV_BUF_SIZE);
+            ringbuffer_init(&tcb->rcv_buf, (char *) tcb->rcv_buf_raw, size);
+            memset(&tcb->rcv_buf_stats, 0, sizeof(tcb->rcv_buf_stats));
+            tcb->rcv_buf_stats.size_max = size;
+            tcb->rcv_buf_time = evtimer_now_msec();
+            tcb->rcv_buf_read = 0;
+            tcb->rcv_buf_shrink = 0;
         }
     }
     TCP_DEBUG_LEAVE;
@@ -118,9 +327,141 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb)
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
+    _gnrc_tcp_rcvbuf_autotune_stop(tcb);
     if (tcb->rcv_buf_raw != NULL) {
-        _rcvbuf_free(tcb->rcv_buf_raw);
+        _rcvbuf_free(tcb->rcv_buf_raw, tcb->rcv_buf.size);
         tcb->rcv_buf_raw = NULL;
     }
     TCP_DEBUG_LEAVE;
 }
+
+void _gnrc_tcp_rcvbuf_autotune(gnrc_tcp_tcb_t *tcb, size_t read)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t now = evtimer_now_msec();
+    uint32_t elapsed = now - tcb->rcv_buf_time;
+    uint32_t interval = (tcb->srtt > 0) ? (uint32_t)tcb->srtt : CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+
+    tcb->rcv_buf_read += read;
+    tcb->rcv_buf_stats.read += read;
+
+    /* Complete a pending shrink as soon as the advertised window fits */
+    _rcvbuf_shrink(tcb);
+
+    /* Measure how much data the user reads per round trip time */
+    if (interval < CONFIG_GNRC_TCP_RTO_GRANULARITY_MS) {
+        interval = CONFIG_GNRC_TCP_RTO_GRANULARITY_MS;
+    }
+    if (elapsed < interval) {
+        _rcvbuf_timer_arm(tcb);
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    /* The window must hold twice the data read per round trip time to keep the
+     * peer from waiting for window updates. Idle time lowers the rate. */
+    size_t old_size = tcb->rcv_buf.size;
+    uint64_t target = ((uint64_t)tcb->rcv_buf_read * 2 * interval) / elapsed;
+    tcb->rcv_buf_time = now;
+    tcb->rcv_buf_read = 0;
+
+    if (target > old_size) {
+        size_t size = _rcvbuf_clamp((target < GNRC_TCP_RCV_BUF_SIZE) ? target
+                                                                      : GNRC_TCP_RCV_BUF_SIZE);
+        tcb->rcv_buf_shrink = 0;
+        if (size > old_size) {
+            if (_rcvbuf_resize(tcb, size) < 0) {
+                tcb->rcv_buf_stats.grow_failed += 1;
+            }
+            else {
+                tcb->rcv_buf_stats.grown += 1;
+                if (size > tcb->rcv_buf_stats.size_max) {
+                    tcb->rcv_buf_stats.size_max = size;
+                }
+            }
+        }
+    }
+    else if (target < old_size / 2) {
+        /* Shrink with hysteresis. The window already advertised must not be
+         * retracted (RFC 9293, 3.8.6), so the window is not reopened beyond
+         * the smaller size until the peer used up what it was offered. */
+        size_t size = _rcvbuf_clamp(target);
+        tcb->rcv_buf_shrink = (size < old_size) ? size : 0;
+        _rcvbuf_shrink(tcb);
+    }
+    _rcvbuf_timer_arm(tcb);
+    TCP_DEBUG_LEAVE;
+}
+
+void _gnrc_tcp_rcvbuf_autotune_stop(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->status & STATUS_RCVBUF_TIMER) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_rcvbuf);
+        tcb->status &= ~STATUS_RCVBUF_TIMER;
+    }
+    tcb->rcv_buf_shrink = 0;
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_rcvbuf_get_window(const gnrc_tcp_tcb_t *tcb, uint32_t r_edge)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t wnd = ringbuffer_get_free(&tcb->rcv_buf);
+
+    /* Keep the right edge while shrinking, unless the smaller buffer has room beyond it */
+    if (tcb->rcv_buf_shrink > 0) {
+        uint32_t limit = LSS_32_BIT(tcb->rcv_nxt, r_edge) ? r_edge - tcb->rcv_nxt : 0;
+        if (tcb->rcv_buf_shrink > tcb->rcv_buf.avail &&
+            tcb->rcv_buf_shrink - tcb->rcv_buf.avail > limit) {
+            limit = tcb->rcv_buf_shrink - tcb->rcv_buf.avail;
+        }
+        if (wnd > limit) {
+            wnd = limit;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return wnd;
+}
+
+void _gnrc_tcp_rcvbuf_get_stats(const gnrc_tcp_tcb_t *tcb, gnrc_tcp_rcvbuf_stats_t *stats)
+{
+    TCP_DEBUG_ENTER;
+    *stats = tcb->rcv_buf_stats;
+    stats->size = (tcb->rcv_buf_raw != NULL) ? tcb->rcv_buf.size : 0;
+    stats->avail = (tcb->rcv_buf_raw != NULL) ? tcb->rcv_buf.avail : 0;
+    TCP_DEBUG_LEAVE;
+}
+
+size_t _gnrc_tcp_rcvbuf_write(gnrc_tcp_tcb_t *tcb, size_t offset, const void *data,
+                              size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    size_t space = ringbuffer_get_free(rb);
+
+    /* Copy only what fits into the free part of the buffer */
+    if (offset >= space) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (len > space - offset) {
+        len = space - offset;
+    }
+
+    /* Copy data behind the readable data, wrapping around the end of the buffer */
+    size_t pos = (rb->start + rb->avail + offset) % rb->size;
+    size_t chunk = (len < rb->size - pos) ? len : rb->size - pos;
+    memcpy(rb->buf + pos, data, chunk);
+    memcpy(rb->buf, (const uint8_t *)data + chunk, len - chunk);
+    TCP_DEBUG_LEAVE;
+    return len;
+}
+
+void _gnrc_tcp_rcvbuf_commit(gnrc_tcp_tcb_t *tcb, size_t len)
+{
+    TCP_DEBUG_ENTER;
+    assert(len <= ringbuffer_get_free(&tcb->rcv_buf));
+    tcb->rcv_buf.avail += len;
+    TCP_DEBUG_LEAVE;
+}
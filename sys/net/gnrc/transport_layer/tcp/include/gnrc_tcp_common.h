@@ -47,8 +47,22 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_RTT_PENDING    (1 << 5) /**< Internal: Status bitmask RTT_PENDING */
+#define STATUS_SACK_OK        (1 << 6) /**< Internal: Status bitmask SACK_OK */
+#define STATUS_WND_SCALE      (1 << 7) /**< Internal: Status bitmask WND_SCALE */
+#define STATUS_FAST_RECOVERY  (1 << 8) /**< Internal: Status bitmask FAST_RECOVERY */
+#define STATUS_FASTOPEN       (1 << 9) /**< Internal: Status bitmask FASTOPEN */
+#define STATUS_RCVBUF_TIMER   (1 << 10) /**< Internal: Status bitmask RCVBUF_TIMER */
+#define STATUS_FASTOPEN_LISTEN (1 << 11) /**< Internal: Status bitmask FASTOPEN_LISTEN */
 /** @} */
 
+/**
+ * @brief Number of duplicate ACKs triggering a fast retransmit.
+ *
+ * @see https://www.rfc-editor.org/rfc/rfc5681#section-3.2
+ */
+#define DUPACK_THRESHOLD (3U)
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -86,6 +100,7 @@ extern "C" {
 #define MSG_TYPE_RETRANSMISSION     (GNRC_NETAPI_MSG_TYPE_ACK + 104) /**< Internal: message id */
 #define MSG_TYPE_TIMEWAIT           (GNRC_NETAPI_MSG_TYPE_ACK + 105) /**< Internal: message id */
 #define MSG_TYPE_NOTIFY_USER        (GNRC_NETAPI_MSG_TYPE_ACK + 106) /**< Internal: message id */
+#define MSG_TYPE_RCVBUF             (GNRC_NETAPI_MSG_TYPE_ACK + 107) /**< Internal: message id */
 /** @} */
 
 /**
@@ -101,7 +116,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0) /**< Internal: operator < */
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0) /**< Internal: operator <= */
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y)) /**< Internal: operator > */
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y)) /**< Internal: operator >= */
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y)) /**< Internal: operator >= */
 /** @} */
 
 /**
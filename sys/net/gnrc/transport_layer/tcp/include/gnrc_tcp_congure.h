@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       Internal hooks into the CongURE implementations of GNRC TCP.
+ *
+ * The functions are only available with the module `gnrc_tcp_congure_reno`.
+ */
+
+#ifndef GNRC_TCP_CONGURE_H
+#define GNRC_TCP_CONGURE_H
+
+#include <stdint.h>
+
+#include "congure.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Seeds the initial window of a TCP Reno or ABE state object from
+ *        the SMSS of its connection.
+ *
+ * Must be called after the init() method of the driver. State objects of
+ * other CongURE implementations are left untouched.
+ *
+ * @param[in,out] c      CongURE state object.
+ * @param[in]     smss   Sender maximum segment size of the connection.
+ */
+void _gnrc_tcp_congure_reno_set_mss(congure_snd_t *c, uint32_t smss);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CONGURE_H */
+/** @} */
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP Fast Open (RFC 7413) cookie handling.
+ *
+ * The functions are only available with the module `gnrc_tcp_fastopen`.
+ */
+
+#ifndef GNRC_TCP_FASTOPEN_H
+#define GNRC_TCP_FASTOPEN_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the secret used to generate cookies and the cookie cache.
+ */
+void _gnrc_tcp_fastopen_init(void);
+
+/**
+ * @brief Generates the cookie for the peer of a connection (server side).
+ *
+ * @param[in]  tcb      TCB holding the peer address.
+ * @param[out] cookie   Generated cookie, must hold CONFIG_GNRC_TCP_FASTOPEN_COOKIE_LEN bytes.
+ */
+void _gnrc_tcp_fastopen_cookie_gen(const gnrc_tcp_tcb_t *tcb, uint8_t *cookie);
+
+/**
+ * @brief Checks the cookie sent by the peer of a connection (server side).
+ *
+ * @param[in] tcb          TCB holding the peer address.
+ * @param[in] cookie       Cookie sent by the peer.
+ * @param[in] cookie_len   Length of @p cookie in bytes.
+ *
+ * @returns   true if @p cookie was handed out to the peer by this host.
+ *            false otherwise.
+ */
+bool _gnrc_tcp_fastopen_cookie_valid(const gnrc_tcp_tcb_t *tcb, const uint8_t *cookie,
+                                     uint8_t cookie_len);
+
+/**
+ * @brief Looks up the cached cookie for the peer of a connection (client side).
+ *
+ * @param[in]  tcb      TCB holding the peer address.
+ * @param[out] cookie   Cached cookie, must hold TCP_OPTION_LENGTH_TFO_COOKIE_MAX bytes.
+ * @param[out] mss      MSS the peer announced when it handed out the cookie.
+ *
+ * @returns   Length of the cached cookie in bytes.
+ *            Zero if no cookie is cached for the peer.
+ */
+uint8_t _gnrc_tcp_fastopen_cache_get(const gnrc_tcp_tcb_t *tcb, uint8_t *cookie, uint16_t *mss);
+
+/**
+ * @brief Caches a cookie handed out by the peer of a connection (client side).
+ *
+ * @param[in] tcb          TCB holding the peer address and its MSS.
+ * @param[in] cookie       Cookie sent by the peer.
+ * @param[in] cookie_len   Length of @p cookie in bytes.
+ */
+void _gnrc_tcp_fastopen_cache_set(const gnrc_tcp_tcb_t *tcb, const uint8_t *cookie,
+                                  uint8_t cookie_len);
+
+/**
+ * @brief Drops the cached cookie of the peer of a connection (client side).
+ *
+ * @param[in] tcb   TCB holding the peer address.
+ */
+void _gnrc_tcp_fastopen_cache_del(const gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_FASTOPEN_H */
+/** @} */
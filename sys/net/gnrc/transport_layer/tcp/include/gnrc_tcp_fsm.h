@@ -51,7 +51,8 @@ typedef enum {
  */
 typedef enum {
     FSM_EVENT_CALL_OPEN,          /* User function call: open */
-    FSM_EVENT_CALL_SEND,          /* User function call: send */
+    FSM_EVENT_CALL_SEND,          /* User function call: send, buf is an iolist_t */
+    FSM_EVENT_CALL_SEND_PKT,      /* User function call: send, buf is a gnrc_pktsnip_t ** */
     FSM_EVENT_CALL_RECV,          /* User function call: recv */
     FSM_EVENT_CALL_CLOSE,         /* User function call: close */
     FSM_EVENT_CALL_ABORT,         /* User function call: abort */
@@ -59,6 +60,7 @@ typedef enum {
     FSM_EVENT_TIMEOUT_TIMEWAIT,   /* Timeout: timewait */
     FSM_EVENT_TIMEOUT_RETRANSMIT, /* Timeout: retransmit */
     FSM_EVENT_TIMEOUT_CONNECTION, /* Timeout: connection */
+    FSM_EVENT_TIMEOUT_RCVBUF,     /* Timeout: receive buffer autotuning */
     FSM_EVENT_SEND_PROBE,         /* Send zero window probe */
     FSM_EVENT_CLEAR_RETRANSMIT    /* Clear retransmission mechanism */
 } _gnrc_tcp_fsm_event_t;
@@ -29,6 +29,18 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of blocks in a SACK option.
+ */
+#define TCP_OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Maximum shift count of the window scale option.
+ *
+ * @see https://www.rfc-editor.org/rfc/rfc7323#section-2.3
+ */
+#define TCP_OPTION_WS_SHIFT_MAX (14U)
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -42,6 +54,76 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option, preceded by a NOP.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_ws(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Helper function to build the SACK permitted option, preceded by two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the head of the SACK option, preceded by two NOPs.
+ *
+ * @param[in] nblocks   Number of blocks following the head.
+ *
+ * @returns   Head of the SACK option.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t nblocks)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + nblocks * TCP_OPTION_LENGTH_SACK_BLOCK));
+}
+
+/**
+ * @brief Helper function to build the head of the TCP Fast Open option, preceded by two NOPs.
+ *
+ * @param[in] cookie_len   Length of the cookie following the head, zero for a cookie request.
+ *
+ * @returns   Head of the TCP Fast Open option.
+ */
+static inline uint32_t _gnrc_tcp_option_build_tfo(uint8_t cookie_len)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_TFO << 8) |
+            (TCP_OPTION_LENGTH_MIN + cookie_len));
+}
+
+/**
+ * @brief Calculates the window scale shift count to announce.
+ *
+ * @returns   Smallest shift count that allows to announce the whole receive buffer.
+ */
+static inline uint8_t _gnrc_tcp_option_get_rcv_wnd_scale(void)
+{
+    uint8_t shift = 0;
+    while ((shift < TCP_OPTION_WS_SHIFT_MAX) && ((GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX)) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -59,13 +141,25 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     hdr   TCP header to be parsed.
+ * Window scaling and selective acknowledgements are negotiated from SYN
+ * segments received in state LISTEN or SYN_SENT only.
+ *
+ * @param[in,out] tcb        TCB holding the connection information.
+ * @param[in]     hdr        TCP header to be parsed.
+ * @param[out]    sack       Blocks of the SACK option, must hold
+ *                           TCP_OPTION_SACK_BLOCKS_MAX entries.
+ * @param[out]    sack_len   Number of blocks written to @p sack.
+ * @param[out]    cookie     Cookie of the TCP Fast Open option of a SYN, must hold
+ *                           TCP_OPTION_LENGTH_TFO_COOKIE_MAX bytes.
+ * @param[out]    cookie_len Length of @p cookie, zero for a cookie request.
+ *                           -1 if the segment carries no TCP Fast Open option.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr,
+                           gnrc_tcp_sack_block_t *sack, uint8_t *sack_len,
+                           uint8_t *cookie, int8_t *cookie_len);
 
 #ifdef __cplusplus
 }
@@ -63,6 +63,26 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
                         const uint32_t seq_num, const uint32_t ack_num,
                         void *payload, const size_t payload_len);
 
+/**
+ * @brief Build a TCP packet around an existing payload without copying it.
+ *
+ * @param[in,out] tcb           TCB holding the connection information.
+ * @param[out]    out_pkt       Pointer to packet to build.
+ * @param[out]    seq_con       Sequence number consumption of built packet.
+ * @param[in]     ctl           Control bits to set in @p out_pkt.
+ * @param[in]     seq_num       Sequence number of the new packet.
+ * @param[in]     ack_num       Acknowledgment number of the new packet.
+ * @param[in]     pay_snp       Payload, may be NULL. It becomes part of @p out_pkt
+ *                              on success and is left untouched on error.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+int _gnrc_tcp_pkt_build_snip(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
+                             uint16_t *seq_con, const uint16_t ctl,
+                             const uint32_t seq_num, const uint32_t ack_num,
+                             gnrc_pktsnip_t *pay_snp);
+
 /**
  * @brief Sends packet to peer.
  *
@@ -114,6 +134,8 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
+ *                             On a retransmit, @p pkt must be the oldest
+ *                             packet in the queue and the timer is backed off.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
@@ -123,7 +145,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -133,6 +155,16 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks segments in the retransmission queue as selectively acknowledged.
+ *
+ * @param[in,out] tcb        TCB holding the connection information.
+ * @param[in]     sack       Blocks of the received SACK option.
+ * @param[in]     sack_len   Number of blocks in @p sack.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_sack_block_t *sack,
+                        const uint8_t sack_len);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
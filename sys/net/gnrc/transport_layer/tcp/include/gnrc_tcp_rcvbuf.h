@@ -20,6 +20,9 @@
 #ifndef GNRC_TCP_RCVBUF_H
 #define GNRC_TCP_RCVBUF_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -37,7 +40,7 @@ void _gnrc_tcp_rcvbuf_init(void);
  * @param[in,out] tcb   TCB that acquires receive buffer.
  *
  * @returns   Zero  on success.
- *            -ENOMEM if all receive buffers are currently used.
+ *            -ENOMEM if the receive buffer pool is exhausted.
  */
 int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 
@@ -48,6 +51,73 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Adapt the receive buffer size to the rate the user reads data at.
+ *
+ * Once per round trip time the buffer is resized to hold twice the data the
+ * user read in that time. It grows up to GNRC_TCP_RCV_BUF_SIZE, if the shared
+ * pool has space left, and shrinks down to CONFIG_GNRC_TCP_RCVBUF_MIN_SIZE.
+ * A shrink is kept pending until the data held plus the receive window
+ * already advertised fit the smaller size, so the window is never retracted.
+ * Meanwhile _gnrc_tcp_rcvbuf_get_window() does not reopen the window beyond
+ * its right edge. A timer calls this function with @p read set to zero while
+ * the buffer is larger than its minimum, so idle connections shrink as well.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     read   Number of bytes the user just read from the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_autotune(gnrc_tcp_tcb_t *tcb, size_t read);
+
+/**
+ * @brief Stop autotuning the receive buffer, dropping a pending shrink.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ */
+void _gnrc_tcp_rcvbuf_autotune_stop(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the receive window to advertise.
+ *
+ * @param[in] tcb      TCB holding the receive buffer, rcv_nxt must be up to date.
+ * @param[in] r_edge   Right edge of the window advertised so far.
+ *
+ * @returns   The free space of the receive buffer. While a shrink is pending,
+ *            limited to @p r_edge or the room the smaller buffer leaves,
+ *            whichever is larger.
+ */
+uint32_t _gnrc_tcp_rcvbuf_get_window(const gnrc_tcp_tcb_t *tcb, uint32_t r_edge);
+
+/**
+ * @brief Get the receive buffer statistics of a connection.
+ *
+ * @param[in]  tcb     TCB holding the receive buffer.
+ * @param[out] stats   Receive buffer statistics.
+ */
+void _gnrc_tcp_rcvbuf_get_stats(const gnrc_tcp_tcb_t *tcb, gnrc_tcp_rcvbuf_stats_t *stats);
+
+/**
+ * @brief Copy data into the free part of the receive buffer without making it readable.
+ *
+ * Used to store out-of-order data until the missing data arrived.
+ *
+ * @param[in,out] tcb      TCB holding the receive buffer.
+ * @param[in]     offset   Offset of @p data behind the readable data in bytes.
+ * @param[in]     data     Data to copy.
+ * @param[in]     len      Number of bytes in @p data.
+ *
+ * @returns   Number of bytes copied, limited by the free space in the receive buffer.
+ */
+size_t _gnrc_tcp_rcvbuf_write(gnrc_tcp_tcb_t *tcb, size_t offset, const void *data,
+                              size_t len);
+
+/**
+ * @brief Make data previously copied with _gnrc_tcp_rcvbuf_write() readable.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     len   Number of bytes following the readable data to make readable.
+ */
+void _gnrc_tcp_rcvbuf_commit(gnrc_tcp_tcb_t *tcb, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
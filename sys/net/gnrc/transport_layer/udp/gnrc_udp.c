@@ -29,6 +29,7 @@
 #include "net/gnrc/udp.h"
 #include "net/gnrc.h"
 #include "net/gnrc/icmpv6/error.h"
+#include "net/gnrc/pktlat.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG 0
@@ -95,7 +96,7 @@ static uint16_t _calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr,
     }
 }
 
-static void _receive(gnrc_pktsnip_t *pkt)
+void gnrc_udp_demux(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *udp, *ipv6;
     udp_hdr_t *hdr;
@@ -237,10 +238,12 @@ static void *_event_loop(void *arg)
         switch (msg.type) {
             case GNRC_NETAPI_MSG_TYPE_RCV:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
-                _receive(msg.content.ptr);
+                gnrc_pktlat_stamp(msg.content.ptr, GNRC_PKTLAT_TRANSPORT_RX);
+                gnrc_udp_demux(msg.content.ptr);
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
+                gnrc_pktlat_stamp(msg.content.ptr, GNRC_PKTLAT_TRANSPORT_TX);
                 _send(msg.content.ptr);
                 break;
             case GNRC_NETAPI_MSG_TYPE_SET:
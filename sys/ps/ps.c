@@ -34,6 +34,35 @@
 #include "tlsf-malloc.h"
 #endif
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+static void _print_latency(void)
+{
+    printf("\n\twakeup latency histogram [usec]\n\tpid |");
+    for (unsigned b = 0; b < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; b++) {
+        if (b == 0) {
+            printf(" %8s", "0");
+        }
+        else if (b == CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1) {
+            printf("  >=%6lu", 1LU << (b - 1));
+        }
+        else {
+            printf("   <%6lu", 1LU << b);
+        }
+    }
+    puts("");
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) == NULL) {
+            continue;
+        }
+        printf("\t%3" PRIkernel_pid " |", i);
+        for (unsigned b = 0; b < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; b++) {
+            printf(" %8" PRIu32, sched_pidlist[i].latency_hist[b]);
+        }
+        puts("");
+    }
+}
+#endif
+
 /**
  * @brief Prints a list of running threads including stack usage to stdout.
  */
@@ -53,6 +82,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
            "| runtime  | switches  | runtime_usec "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+           "| max latency_usec "
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -119,6 +151,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    " | %2d.%03d%% |  %8u  | %10"PRIu32" "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   "  | %16"PRIu32" "
 #endif
                    "\n",
                    thread_getpid_of(p),
@@ -132,6 +167,9 @@ void ps(void)
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
                    , runtime_major, runtime_minor, switches, ztimer_us
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_LATENCY
+                   , sched_pidlist[i].latency_max
 #endif
                   );
         }
@@ -148,4 +186,7 @@ void ps(void)
     printf("\tTotal used size: %u\n", sizes.used);
 #   endif
 #endif
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    _print_latency();
+#endif
 }
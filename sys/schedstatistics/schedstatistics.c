@@ -21,6 +21,7 @@
  * @}
  */
 
+#include "bitarithm.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
@@ -32,6 +33,42 @@
  */
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+/* ZTIMER_USEC is not initialized yet when the first threads are created */
+static bool _latency_enabled;
+/* Thread the CPU is accounted to, KERNEL_PID_UNDEF while none is scheduled */
+static kernel_pid_t _running = KERNEL_PID_UNDEF;
+
+static void _record_latency(schedstat_t *stat, uint32_t latency)
+{
+    unsigned bucket = (latency == 0) ? 0 : bitarithm_msb(latency) + 1;
+
+    if (bucket >= CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS) {
+        bucket = CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS - 1;
+    }
+    stat->latency_hist[bucket]++;
+    if (latency > stat->latency_max) {
+        stat->latency_max = latency;
+    }
+    stat->waking = false;
+}
+
+void sched_wakeup_callback(kernel_pid_t pid)
+{
+    if (!_latency_enabled) {
+        return;
+    }
+    if (pid == _running) {
+        /* The thread blocked and was woken up again before sched_run()
+         * switched away from it, so it did not wait at all. */
+        _record_latency(&sched_pidlist[pid], 0);
+        return;
+    }
+    sched_pidlist[pid].wakeup = ztimer_now(ZTIMER_USEC);
+    sched_pidlist[pid].waking = true;
+}
+#endif
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = ztimer_now(ZTIMER_USEC);
@@ -47,7 +84,15 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+        if (next_stat->waking) {
+            _record_latency(next_stat, now - next_stat->wakeup);
+        }
+#endif
     }
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    _running = next_thread;
+#endif
 }
 
 void init_schedstatistics(void)
@@ -58,4 +103,8 @@ void init_schedstatistics(void)
     active_stat->laststart = ztimer_now(ZTIMER_USEC);
     active_stat->schedules = 1;
     sched_register_cb(sched_statistics_cb);
+#if IS_USED(MODULE_SCHEDSTATISTICS_LATENCY)
+    _running = thread_getpid();
+    _latency_enabled = true;
+#endif
 }
@@ -950,6 +950,16 @@ static void _netif_list(netif_t *iface)
 #endif
 #ifdef MODULE_NETSTATS_IPV6
     _netif_stats(iface, NETSTATS_IPV6, false);
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_RX_POLL)
+    const gnrc_netif_rx_poll_t *rx_poll =
+        &container_of(iface, gnrc_netif_t, netif)->rx_poll;
+
+    printf("          RX %s (threshold %u budget %u) to polled %" PRIu32
+           " to interrupt %" PRIu32 "\n",
+           rx_poll->polling ? "polled" : "interrupt",
+           (unsigned)rx_poll->threshold, (unsigned)rx_poll->budget,
+           rx_poll->to_poll, rx_poll->to_irq);
 #endif
     puts("");
 }
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print the per-layer packet latency of GNRC
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/pktlat.h"
+#include "shell.h"
+
+static void _print_hist(gnrc_pktlat_layer_t layer)
+{
+    gnrc_pktlat_hist_t hist;
+
+    gnrc_pktlat_get(layer, &hist);
+    printf("%-12s packets: %" PRIu32, gnrc_pktlat_layer_str(layer), hist.count);
+    if (hist.count == 0) {
+        puts("");
+        return;
+    }
+    printf(" avg: %" PRIu32 " us max: %" PRIu32 " us\n",
+           (uint32_t)(hist.sum / hist.count), hist.max);
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTLAT_HIST_BUCKETS; i++) {
+        if (hist.hist[i] == 0) {
+            continue;
+        }
+        if (i == CONFIG_GNRC_PKTLAT_HIST_BUCKETS - 1) {
+            printf("    >= %7lu us: %" PRIu32 "\n",
+                   (i == 0) ? 0LU : 1LU << (i - 1), hist.hist[i]);
+        }
+        else {
+            printf("    < %8lu us: %" PRIu32 "\n", 1LU << i, hist.hist[i]);
+        }
+    }
+}
+
+static int _gnrc_pktlat(int argc, char **argv)
+{
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        gnrc_pktlat_reset();
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: %s [reset]\n", argv[0]);
+        return 1;
+    }
+    for (unsigned layer = GNRC_PKTLAT_NONE + 1; layer < GNRC_PKTLAT_NUMOF;
+         layer++) {
+        _print_hist(layer);
+    }
+    return 0;
+}
+
+SHELL_COMMAND(pktlat, "Prints the time packets spend in each GNRC layer",
+              _gnrc_pktlat);
+
+/** @} */
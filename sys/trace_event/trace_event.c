@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace_event
+ * @{
+ *
+ * @file
+ * @brief       Structured execution tracing implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "irq.h"
+#include "sched.h"
+#include "thread.h"
+#include "trace_event.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+#include "schedstatistics.h"
+#endif
+
+#ifdef CPU_NATIVE
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "native_internal.h"
+#endif
+
+static trace_event_t _ring[CONFIG_TRACE_EVENT_BUFSIZE];
+/* number of events recorded since the last reset, the next slot is
+ * _pos % CONFIG_TRACE_EVENT_BUFSIZE */
+static uint32_t _pos;
+static uint8_t _enabled = 1;
+
+void trace_event_record(uint16_t id, trace_event_kind_t kind, uint32_t arg)
+{
+    if (!atomic_load_u8(&_enabled)) {
+        return;
+    }
+
+    uint32_t time = ztimer_now(ZTIMER_USEC);
+    trace_event_t *event = &_ring[atomic_fetch_add_u32(&_pos, 1) %
+                                  CONFIG_TRACE_EVENT_BUFSIZE];
+
+    event->time = time;
+    event->arg = arg;
+    event->id = id;
+    event->ctx = irq_is_in() ? TRACE_EVENT_CTX_ISR : (uint8_t)thread_getpid();
+    event->kind = kind;
+}
+
+void trace_event_enable(bool enable)
+{
+    atomic_store_u8(&_enabled, enable);
+}
+
+unsigned trace_event_get(trace_event_t *events, unsigned numof)
+{
+    uint8_t enabled = atomic_load_u8(&_enabled);
+    uint32_t pos;
+    unsigned n;
+
+    trace_event_enable(false);
+    pos = atomic_load_u32(&_pos);
+    n = (pos > CONFIG_TRACE_EVENT_BUFSIZE) ? CONFIG_TRACE_EVENT_BUFSIZE : pos;
+    if (n > numof) {
+        n = numof;
+    }
+    for (unsigned i = 0; i < n; i++) {
+        events[i] = _ring[(pos - n + i) % CONFIG_TRACE_EVENT_BUFSIZE];
+    }
+    atomic_store_u8(&_enabled, enabled);
+    return n;
+}
+
+void trace_event_dump(void)
+{
+    uint8_t enabled = atomic_load_u8(&_enabled);
+    uint32_t pos;
+    unsigned n;
+
+    trace_event_enable(false);
+    pos = atomic_load_u32(&_pos);
+    n = (pos > CONFIG_TRACE_EVENT_BUFSIZE) ? CONFIG_TRACE_EVENT_BUFSIZE : pos;
+    printf("trace_event: begin %u events\n", n);
+#ifdef DEVELHELP
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+
+        if (thread != NULL) {
+            printf("thread %u %s\n", (unsigned)pid, thread_get_name(thread));
+        }
+    }
+#endif
+    for (unsigned i = 0; i < n; i++) {
+        const trace_event_t *event =
+            &_ring[(pos - n + i) % CONFIG_TRACE_EVENT_BUFSIZE];
+
+        printf("te %" PRIu32 " %u %u %u %" PRIu32 "\n", event->time,
+               event->ctx, event->kind, event->id, event->arg);
+    }
+    puts("trace_event: end");
+    atomic_store_u8(&_enabled, enabled);
+}
+
+#ifdef CPU_NATIVE
+int trace_event_dump_file(const char *path)
+{
+    static const char magic[8] = "RIOTTEV1";
+    uint8_t enabled = atomic_load_u8(&_enabled);
+    uint32_t pos;
+    int res, fd;
+    unsigned n;
+
+    trace_event_enable(false);
+    pos = atomic_load_u32(&_pos);
+    n = (pos > CONFIG_TRACE_EVENT_BUFSIZE) ? CONFIG_TRACE_EVENT_BUFSIZE : pos;
+    _native_in_syscall++;
+    fd = real_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        res = -errno;
+        goto out;
+    }
+    res = n;
+    if (real_write(fd, magic, sizeof(magic)) != sizeof(magic)) {
+        res = -EIO;
+    }
+    for (unsigned i = 0; (res >= 0) && (i < n); i++) {
+        const trace_event_t *event =
+            &_ring[(pos - n + i) % CONFIG_TRACE_EVENT_BUFSIZE];
+
+        if (real_write(fd, event, sizeof(*event)) != sizeof(*event)) {
+            res = -EIO;
+        }
+    }
+    real_close(fd);
+out:
+    _native_in_syscall--;
+    atomic_store_u8(&_enabled, enabled);
+    return res;
+}
+#endif
+
+void trace_event_reset(void)
+{
+    atomic_store_u32(&_pos, 0);
+}
+
+#if IS_USED(MODULE_TRACE_EVENT_SCHED)
+static void _sched_cb(kernel_pid_t active, kernel_pid_t next)
+{
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+    sched_statistics_cb(active, next);
+#endif
+    /* the callback runs in ISR context, so the PIDs are recorded as argument
+     * and the decoder puts the slices on the respective thread */
+    if (active != KERNEL_PID_UNDEF) {
+        trace_event_record(TRACE_EVENT_ID_THREAD, TRACE_EVENT_END, active);
+    }
+    if (next != KERNEL_PID_UNDEF) {
+        trace_event_record(TRACE_EVENT_ID_THREAD, TRACE_EVENT_BEGIN, next);
+    }
+}
+
+#endif
+
+void auto_init_trace_event(void)
+{
+    /* events are timestamped from any context, so the clock is kept running
+     * for the lifetime of the application */
+    ztimer_acquire(ZTIMER_USEC);
+#if IS_USED(MODULE_TRACE_EVENT_SCHED)
+    /* the thread running auto_init was scheduled before the callback was
+     * registered */
+    trace_event_record(TRACE_EVENT_ID_THREAD, TRACE_EVENT_BEGIN,
+                       thread_getpid());
+    sched_register_cb(_sched_cb);
+#endif
+}
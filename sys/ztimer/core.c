@@ -32,16 +32,22 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t slack);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
 static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock);
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack);
 
 #ifdef MODULE_ZTIMER_EXTEND
 static inline uint32_t _min_u32(uint32_t a, uint32_t b)
@@ -124,6 +130,12 @@ static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 
 unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_is_set(clock->wheel, timer);
+    }
+#endif
+
     unsigned state = irq_disable();
     unsigned res = _is_set(clock, timer);
 
@@ -132,6 +144,17 @@ unsigned ztimer_is_set(const ztimer_clock_t *clock, const ztimer_t *timer)
 }
 
 bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_remove(clock->wheel, timer);
+    }
+#endif
+
+    return _ztimer_list_remove(clock, timer);
+}
+
+bool _ztimer_list_remove(ztimer_clock_t *clock, ztimer_t *timer)
 {
     bool was_removed = false;
     bool no_clock_user_left = false;
@@ -157,6 +180,35 @@ bool ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
 }
 
 uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_set(clock->wheel, timer, val, 0);
+    }
+#endif
+
+    return _ztimer_set(clock, timer, val, 0);
+}
+
+uint32_t ztimer_set_with_slack(ztimer_clock_t *clock, ztimer_t *timer,
+                               uint32_t val, uint32_t slack)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        return ztimer_wheel_set(clock->wheel, timer, val, slack);
+    }
+#endif
+
+    return _ztimer_set(clock, timer, val, slack);
+}
+
+uint32_t _ztimer_list_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
+{
+    return _ztimer_set(clock, timer, val, 0);
+}
+
+static uint32_t _ztimer_set(ztimer_clock_t *clock, ztimer_t *timer,
+                            uint32_t val, uint32_t slack)
 {
     unsigned state = irq_disable();
 
@@ -192,7 +244,7 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     }
 
     timer->base.offset = val;
-    _add_entry_to_list(clock, &timer->base);
+    _add_entry_to_list(clock, &timer->base, slack);
     if (clock->list.next == &timer->base) {
 #ifdef MODULE_ZTIMER_EXTEND
         if (clock->max_value < UINT32_MAX) {
@@ -221,7 +273,8 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
     return now;
 }
 
-static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry,
+                               uint32_t slack)
 {
     uint32_t delta_sum = 0;
 
@@ -245,6 +298,16 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         list = list->next;
     }
 
+    /* If the next timer fires within the slack, fire together with it */
+    if (slack && list->next &&
+        (list->next->offset - (entry->offset - delta_sum) <= slack)) {
+        delta_sum += list->next->offset;
+        entry->offset = delta_sum;
+        do {
+            list = list->next;
+        } while (list->next && (list->next->offset == 0));
+    }
+
     /* Insert into list */
     entry->next = list->next;
     entry->offset -= delta_sum;
@@ -48,6 +48,7 @@
 #include "ztimer/periph_timer.h"
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
+#include "ztimer/wheel.h"
 #include "ztimer/config.h"
 
 /* both 'stdio_rtt' and 'stdio_semihosting' rely on ztimer for stdio output,
@@ -236,6 +237,9 @@ ztimer_clock_t *const ZTIMER_MSEC = &_ztimer_convert_frac_msec.super.super;
 #  else
 ztimer_clock_t *const ZTIMER_MSEC = ZTIMER_MSEC_BASE;
 #   endif
+#  if MODULE_ZTIMER_MSEC_WHEEL
+static ztimer_wheel_t _ztimer_wheel_msec;
+#  endif
 #endif
 
 #if MODULE_ZTIMER_SEC
@@ -407,6 +411,10 @@ void ztimer_init(void)
               CONFIG_ZTIMER_MSEC_ADJUST);
     ZTIMER_MSEC->adjust = CONFIG_ZTIMER_MSEC_ADJUST;
 #  endif
+#  if MODULE_ZTIMER_MSEC_WHEEL
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using a timing wheel\n");
+    ztimer_wheel_init(ZTIMER_MSEC, &_ztimer_wheel_msec);
+#  endif
 #endif
 
 #if MODULE_ZTIMER_SEC
@@ -37,7 +37,7 @@ static void _ztimer_periodic_reset(ztimer_periodic_t *timer, ztimer_now_t now)
 
     timer->last = target;
 
-    ztimer_set(timer->clock, &timer->timer, offset);
+    ztimer_set_with_slack(timer->clock, &timer->timer, offset, timer->slack);
 }
 
 static void _ztimer_periodic_callback(void *arg)
@@ -72,7 +72,9 @@ void ztimer_periodic_init(ztimer_clock_t *clock, ztimer_periodic_t *timer,
 
 void ztimer_periodic_start(ztimer_periodic_t *timer)
 {
-    timer->last = ztimer_set(timer->clock, &timer->timer, timer->interval) + timer->interval;
+    timer->last = ztimer_set_with_slack(timer->clock, &timer->timer,
+                                        timer->interval, timer->slack)
+                  + timer->interval;
 }
 
 void ztimer_periodic_stop(ztimer_periodic_t *timer)
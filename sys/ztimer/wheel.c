@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timing wheel implementation
+ *
+ * Timers in the wheel use ztimer_base_t::next to link the timers of one slot,
+ * and ztimer_base_t::offset to store their absolute expiry tick. A timer with
+ * expiry `e` is filed into the lowest level `n` at which `e` lies less than
+ * ZTIMER_WHEEL_SLOTS slots ahead of the wheel's base, in slot
+ * `(e >> (n * ZTIMER_WHEEL_LEVEL_BITS)) % ZTIMER_WHEEL_SLOTS`.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "irq.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if (CONFIG_ZTIMER_WHEEL_LEVELS < 1) || \
+    (CONFIG_ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_LEVEL_BITS > 32)
+#error "CONFIG_ZTIMER_WHEEL_LEVELS must be between 1 and 6"
+#endif
+
+#define SLOT_MASK           (ZTIMER_WHEEL_SLOTS - 1)
+#define LEVEL_SHIFT(level)  ((level) * ZTIMER_WHEEL_LEVEL_BITS)
+
+static void _wheel_callback(void *arg);
+
+static inline unsigned _slot_of(uint32_t tick, unsigned level)
+{
+    return (tick >> LEVEL_SHIFT(level)) & SLOT_MASK;
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel)
+{
+    assert(clock->list.next == NULL);
+
+    *wheel = (ztimer_wheel_t) {
+        .timer = { .callback = _wheel_callback, .arg = wheel },
+        .clock = clock,
+    };
+    clock->wheel = wheel;
+}
+
+static void _wheel_link(ztimer_wheel_t *wheel, ztimer_t *timer,
+                        unsigned level, unsigned slot)
+{
+    ztimer_base_t **head = &wheel->slots[level][slot];
+
+    timer->base.next = *head;
+    if (*head) {
+        ((ztimer_t *)*head)->wheel_link = &timer->base.next;
+    }
+    *head = &timer->base;
+    timer->wheel_link = head;
+    wheel->pending[level] |= 1UL << slot;
+}
+
+static void _wheel_unlink(ztimer_wheel_t *wheel, ztimer_t *timer)
+{
+    ztimer_base_t **link = timer->wheel_link;
+
+    *link = timer->base.next;
+    if (timer->base.next) {
+        ((ztimer_t *)timer->base.next)->wheel_link = link;
+    }
+    else if ((link >= &wheel->slots[0][0]) &&
+             (link <= &wheel->slots[CONFIG_ZTIMER_WHEEL_LEVELS - 1][SLOT_MASK])) {
+        /* timer was the only one in its slot */
+        unsigned idx = link - &wheel->slots[0][0];
+        wheel->pending[idx / ZTIMER_WHEEL_SLOTS] &=
+            ~(1UL << (idx % ZTIMER_WHEEL_SLOTS));
+    }
+
+    timer->base.next = NULL;
+    timer->wheel_link = NULL;
+    wheel->count--;
+}
+
+/* file a timer expiring `delta` ticks after the wheel's base */
+static void _wheel_file(ztimer_wheel_t *wheel, ztimer_t *timer, uint32_t delta)
+{
+    uint32_t expiry = timer->base.offset;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        unsigned shift = LEVEL_SHIFT(level);
+        uint32_t low = (1UL << shift) - 1;
+        /* number of level slots between base and expiry, without overflow */
+        uint32_t slots = (delta >> shift) +
+                         (((wheel->base & low) + (delta & low)) >> shift);
+
+        if (slots < ZTIMER_WHEEL_SLOTS) {
+            _wheel_link(wheel, timer, level, _slot_of(expiry, level));
+            return;
+        }
+    }
+
+    /* beyond the wheel's range: park in the slot processed last */
+    unsigned top = CONFIG_ZTIMER_WHEEL_LEVELS - 1;
+    _wheel_link(wheel, timer, top, (_slot_of(wheel->base, top) - 1) & SLOT_MASK);
+}
+
+/* returns the distance from base to the next tick that needs processing */
+static uint32_t _wheel_next(const ztimer_wheel_t *wheel)
+{
+    uint32_t next = UINT32_MAX;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        uint32_t pending = wheel->pending[level];
+        if (!pending) {
+            continue;
+        }
+
+        unsigned shift = LEVEL_SHIFT(level);
+        unsigned cur = _slot_of(wheel->base, level);
+        /* rotate, so that bit 0 is the slot the base is in */
+        pending = (pending >> cur) | (pending << ((32 - cur) & 31));
+        unsigned ahead = __builtin_ctzl(pending);
+
+        uint32_t delta = 0;
+        if (ahead) {
+            delta = (((wheel->base >> shift) + ahead) << shift) - wheel->base;
+        }
+        if (delta < next) {
+            next = delta;
+        }
+    }
+
+    return next;
+}
+
+/* move all timers from the base's slots of the upper levels down */
+static void _wheel_cascade(ztimer_wheel_t *wheel)
+{
+    for (unsigned level = CONFIG_ZTIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+        ztimer_base_t **head = &wheel->slots[level][_slot_of(wheel->base, level)];
+
+        while (*head) {
+            ztimer_t *timer = (ztimer_t *)*head;
+            _wheel_unlink(wheel, timer);
+            wheel->count++;
+            _wheel_file(wheel, timer, timer->base.offset - wheel->base);
+        }
+    }
+}
+
+/* move the base up to now, unless that passes a tick needing processing */
+static void _wheel_catch_up(ztimer_wheel_t *wheel, uint32_t now)
+{
+    if (_wheel_next(wheel) > now - wheel->base) {
+        wheel->base = now;
+    }
+}
+
+static void _wheel_arm(ztimer_wheel_t *wheel)
+{
+    uint32_t target = wheel->base + _wheel_next(wheel);
+
+    if (wheel->armed && (target == wheel->target)) {
+        return;
+    }
+
+    uint32_t now = ztimer_now(wheel->clock);
+    uint32_t val = 0;
+    if (target - wheel->base > now - wheel->base) {
+        val = target - now;
+    }
+
+    DEBUG("ztimer_wheel: %p arming for %" PRIu32 " in %" PRIu32 "\n",
+          (void *)wheel, target, val);
+
+    wheel->target = target;
+    wheel->armed = true;
+    _ztimer_list_set(wheel->clock, &wheel->timer, val);
+}
+
+static void _wheel_idle(ztimer_wheel_t *wheel)
+{
+    if (wheel->armed) {
+        wheel->armed = false;
+        _ztimer_list_remove(wheel->clock, &wheel->timer);
+    }
+    ztimer_release(wheel->clock);
+}
+
+/* returns the tick within [target, target + slack] with most trailing zeros */
+static uint32_t _align(uint32_t target, uint32_t slack)
+{
+    for (unsigned bits = 31; bits; bits--) {
+        uint32_t low = (1UL << bits) - 1;
+        uint32_t aligned = (target + low) & ~low;
+        if (aligned - target <= slack) {
+            return aligned;
+        }
+    }
+
+    return target;
+}
+
+uint32_t ztimer_wheel_set(ztimer_wheel_t *wheel, ztimer_t *timer, uint32_t val,
+                          uint32_t slack)
+{
+    unsigned state = irq_disable();
+
+    if (timer->wheel_link) {
+        _wheel_unlink(wheel, timer);
+    }
+    else if (!wheel->count) {
+        /* keep the clock running while the wheel holds timers */
+        ztimer_acquire(wheel->clock);
+    }
+
+    uint32_t now = ztimer_now(wheel->clock);
+    if (wheel->count) {
+        _wheel_catch_up(wheel, now);
+    }
+    else {
+        wheel->base = now;
+    }
+
+    /* optionally subtract a configurable adjustment value */
+    if (val > wheel->clock->adjust_set) {
+        val -= wheel->clock->adjust_set;
+    }
+    else {
+        val = 0;
+    }
+
+    if (slack) {
+        if (slack > UINT32_MAX - val) {
+            slack = UINT32_MAX - val;
+        }
+        val = _align(now + val, slack) - now;
+    }
+
+    /* saturate, the timer will be re-filed once it comes into range */
+    uint32_t delta = now - wheel->base;
+    delta = (val > UINT32_MAX - delta) ? UINT32_MAX : delta + val;
+
+    timer->base.offset = now + val;
+    wheel->count++;
+    _wheel_file(wheel, timer, delta);
+    _wheel_arm(wheel);
+
+    irq_restore(state);
+
+    return now;
+}
+
+bool ztimer_wheel_remove(ztimer_wheel_t *wheel, ztimer_t *timer)
+{
+    bool was_removed = false;
+    unsigned state = irq_disable();
+
+    if (timer->wheel_link) {
+        _wheel_unlink(wheel, timer);
+        if (!wheel->count) {
+            _wheel_idle(wheel);
+        }
+        was_removed = true;
+    }
+
+    irq_restore(state);
+    return was_removed;
+}
+
+unsigned ztimer_wheel_is_set(const ztimer_wheel_t *wheel, const ztimer_t *timer)
+{
+    (void)wheel;
+    return timer->wheel_link != NULL;
+}
+
+static void _wheel_callback(void *arg)
+{
+    ztimer_wheel_t *wheel = arg;
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(wheel->clock);
+
+    wheel->armed = false;
+
+    while (wheel->count) {
+        uint32_t next = _wheel_next(wheel);
+        if (next > now - wheel->base) {
+            wheel->base = now;
+            break;
+        }
+
+        wheel->base += next;
+        _wheel_cascade(wheel);
+
+        /* fire all timers of the base tick, including those (re)set for it
+         * by the callbacks */
+        ztimer_base_t *entry;
+        while ((entry = wheel->slots[0][_slot_of(wheel->base, 0)])) {
+            ztimer_t *timer = (ztimer_t *)entry;
+            _wheel_unlink(wheel, timer);
+            if (!wheel->count) {
+                /* the clock timer keeps the clock running until we return */
+                ztimer_release(wheel->clock);
+            }
+            DEBUG("ztimer_wheel: %p trigger %p at %" PRIu32 "\n",
+                  (void *)wheel, (void *)timer, wheel->base);
+            irq_restore(state);
+            timer->callback(timer->arg);
+            state = irq_disable();
+            /* callbacks may have moved the base up to a later ztimer_now() */
+            now = ztimer_now(wheel->clock);
+        }
+    }
+
+    if (wheel->count) {
+        _wheel_arm(wheel);
+    }
+
+    irq_restore(state);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure neighbor cache lookups of the NIB
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+
+#include "_nib-internal.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#define IFACE               (1U)
+
+static const unsigned _fill[] = { 4, 16, 64, 256 };
+static ipv6_addr_t _addr;
+static char _name[16];
+
+static void _set_addr(ipv6_addr_t *addr, unsigned i)
+{
+    ipv6_addr_from_str(addr, "fe80::ba27:ebff:fe00:0");
+    addr->u8[14] = i >> 8;
+    addr->u8[15] = i & 0xff;
+}
+
+static void _get(void)
+{
+    _nib_onl_get(&_addr, IFACE);
+}
+
+int main(void)
+{
+    unsigned numof = 0;
+
+    puts("NIB neighbor cache lookup benchmark");
+    printf("entries: %u, hash buckets: %u\n",
+           (unsigned)CONFIG_GNRC_IPV6_NIB_NUMOF,
+           (unsigned)CONFIG_GNRC_IPV6_NIB_ONL_HASH_BUCKETS);
+    _nib_acquire();
+    for (unsigned i = 0; i < ARRAY_SIZE(_fill); i++) {
+        if (_fill[i] > CONFIG_GNRC_IPV6_NIB_NUMOF) {
+            break;
+        }
+        for (; numof < _fill[i]; numof++) {
+            _set_addr(&_addr, numof);
+            if (_nib_nc_add(&_addr, IFACE,
+                            GNRC_IPV6_NIB_NC_INFO_NUD_STATE_STALE) == NULL) {
+                puts("[FAILED] unable to add neighbor");
+                _nib_release();
+                return 1;
+            }
+        }
+        printf("%u neighbors\n", numof);
+        /* _addr is the last added neighbor */
+        if (_nib_onl_get(&_addr, IFACE) == NULL) {
+            puts("[FAILED] neighbor not found");
+            _nib_release();
+            return 1;
+        }
+        snprintf(_name, sizeof(_name), "get hit %u", numof);
+        BENCHMARK_STATS_FUNC(_name, BENCH_RUNS, _get());
+        _set_addr(&_addr, 0xffff);
+        snprintf(_name, sizeof(_name), "get miss %u", numof);
+        BENCHMARK_STATS_FUNC(_name, BENCH_RUNS, _get());
+    }
+    _nib_release();
+    puts("[SUCCESS]");
+    return 0;
+}
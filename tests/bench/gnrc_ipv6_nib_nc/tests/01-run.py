@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+BENCHMARK_REGEXP = r'\{{"benchmark": "{func}", "unit": "\w+", .*\}}'
+
+
+def testfunc(child):
+    child.expect_exact('NIB neighbor cache lookup benchmark')
+    child.expect(r'entries: \d+, hash buckets: \d+')
+    child.expect(r'\d+ neighbors')
+    child.expect(BENCHMARK_REGEXP.format(func=r"get hit \d+"), timeout=TIMEOUT)
+    child.expect(BENCHMARK_REGEXP.format(func=r"get miss \d+"), timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]', timeout=TIMEOUT)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
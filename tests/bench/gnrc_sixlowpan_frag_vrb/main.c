@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the VRB work per forwarded 6LoWPAN fragment
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "xtimer.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
+#endif
+
+#ifndef FWD_RUNS
+#define FWD_RUNS            (100000UL)
+#endif
+
+#define SRC_LEN             (8U)
+
+static const unsigned _fill[] = { 4, 16, 64, 128 };
+static const uint8_t _out_dst[] = { 0xfa, 0xce, 0x00, 0x00,
+                                    0x00, 0x00, 0x00, 0x01 };
+static gnrc_netif_t _dummy_netif;
+static gnrc_sixlowpan_frag_rb_base_t _base = {
+    .src = { 0xbe, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    .src_len = SRC_LEN,
+    .datagram_size = 1280U,
+};
+static unsigned _next;
+static unsigned _numof;
+static char _name[16];
+
+static void _set_base(gnrc_sixlowpan_frag_rb_base_t *base, unsigned i)
+{
+    base->src[6] = i >> 8;
+    base->src[7] = i & 0xff;
+    base->tag = i * 7;
+}
+
+/* what the VRB does for a subsequent fragment, see _vrb_get() in
+ * gnrc_sixlowpan_frag_rb.c */
+static gnrc_sixlowpan_frag_vrb_t *_fwd(const gnrc_sixlowpan_frag_rb_base_t *base)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    uint32_t now = xtimer_now_usec();
+
+    vrbe = gnrc_sixlowpan_frag_vrb_get(base->src, base->src_len, base->tag);
+    if ((vrbe != NULL) &&
+        ((now - vrbe->super.arrival) > CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_TIMEOUT_US)) {
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        vrbe = NULL;
+    }
+    if (vrbe != NULL) {
+        /* keep the datagrams alive for the whole benchmark */
+        vrbe->super.arrival = now;
+    }
+    return vrbe;
+}
+
+static void _fwd_hit(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+
+    _set_base(&base, _next);
+    _fwd(&base);
+    if (++_next >= _numof) {
+        _next = 0;
+    }
+}
+
+static void _fwd_miss(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+
+    _set_base(&base, 0xffff);
+    _fwd(&base);
+}
+
+int main(void)
+{
+    puts("6LoWPAN VRB forwarding benchmark");
+    printf("entries: %u\n", (unsigned)CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_fill); i++) {
+        uint32_t start, time;
+
+        if (_fill[i] > CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE) {
+            break;
+        }
+        for (; _numof < _fill[i]; _numof++) {
+            gnrc_sixlowpan_frag_rb_base_t base = _base;
+
+            _set_base(&base, _numof);
+            base.arrival = xtimer_now_usec();
+            if (gnrc_sixlowpan_frag_vrb_add(&base, &_dummy_netif, _out_dst,
+                                            sizeof(_out_dst)) == NULL) {
+                puts("[FAILED] unable to add VRB entry");
+                return 1;
+            }
+        }
+        printf("%u datagrams\n", _numof);
+        for (unsigned j = 0; j < _numof; j++) {
+            gnrc_sixlowpan_frag_rb_base_t base = _base;
+
+            _set_base(&base, j);
+            if (_fwd(&base) == NULL) {
+                puts("[FAILED] VRB entry not found");
+                return 1;
+            }
+        }
+        _next = 0;
+        snprintf(_name, sizeof(_name), "fwd hit %u", _numof);
+        BENCHMARK_STATS_FUNC(_name, BENCH_RUNS, _fwd_hit());
+        snprintf(_name, sizeof(_name), "fwd miss %u", _numof);
+        BENCHMARK_STATS_FUNC(_name, BENCH_RUNS, _fwd_miss());
+        snprintf(_name, sizeof(_name), "gc %u", _numof);
+        BENCHMARK_STATS_FUNC(_name, BENCH_RUNS, gnrc_sixlowpan_frag_vrb_gc());
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned long j = 0; j < FWD_RUNS; j++) {
+            _fwd_hit();
+        }
+        time = ztimer_now(ZTIMER_USEC) - start;
+        printf("%u datagrams: %lu fragments/s\n", _numof,
+               (unsigned long)((FWD_RUNS * 1000000ULL) / (time ? time : 1)));
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
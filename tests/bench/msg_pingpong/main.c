@@ -18,27 +18,26 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdint.h>
-#include <stdatomic.h>
 #include <stdio.h>
-#include "macros/units.h"
+
+#include "benchmark.h"
 #include "thread.h"
-#include "clk.h"
 
 #include "msg.h"
-#include "xtimer.h"
 
-#ifndef TEST_DURATION_US
-#define TEST_DURATION_US    (1000000U)
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
 #endif
 
-static char _stack[THREAD_STACKSIZE_MAIN];
+#ifndef BURST_SIZE
+#define BURST_SIZE          (16U)
+#endif
 
-static void _timer_callback(void *_flag)
-{
-    atomic_flag *flag = _flag;
-    atomic_flag_clear(flag);
-}
+static char _stack[THREAD_STACKSIZE_MAIN];
+static char _burst_stack[THREAD_STACKSIZE_MAIN];
+static bool _burst_many;
 
 static void *_second_thread(void *arg)
 {
@@ -52,6 +51,34 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_burst_thread(void *arg)
+{
+    (void)arg;
+
+    static msg_t queue[BURST_SIZE];
+    msg_t buf[BURST_SIZE];
+
+    msg_init_queue(queue, BURST_SIZE);
+
+    while (1) {
+        if (_burst_many) {
+            msg_receive_many(buf, BURST_SIZE, true);
+        }
+        else {
+            msg_receive(buf);
+        }
+    }
+
+    return NULL;
+}
+
+static void _send(kernel_pid_t target)
+{
+    msg_t test;
+
+    msg_send(&test, target);
+}
+
 int main(void)
 {
     puts("main starting");
@@ -64,27 +91,25 @@ int main(void)
                                        NULL,
                                        "second_thread");
 
-    atomic_flag flag = ATOMIC_FLAG_INIT;
-    uint32_t n = 0;
+    BENCHMARK_STATS_FUNC("msg_send() pingpong", BENCH_RUNS, _send(other));
 
-    xtimer_t timer = {
-        .callback = _timer_callback,
-        .arg = &flag,
-    };
-
-    atomic_flag_test_and_set(&flag);
-    xtimer_set(&timer, TEST_DURATION_US);
-
-    while (atomic_flag_test_and_set(&flag)) {
-        msg_t test;
-        msg_send(&test, other);
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    /* bursts: the receiver has a lower priority, so messages pile up in its
+     * queue until the sender blocks */
+    kernel_pid_t burst = thread_create(_burst_stack,
+                                       sizeof(_burst_stack),
+                                       (THREAD_PRIORITY_MAIN + 1),
+                                       THREAD_CREATE_STACKTEST,
+                                       _burst_thread,
+                                       NULL,
+                                       "burst_thread");
+
+    printf("burst size: %u\n", BURST_SIZE);
+    _burst_many = false;
+    BENCHMARK_STATS_FUNC("msg_send() burst msg_receive()", BENCH_RUNS,
+                         _send(burst));
+    _burst_many = true;
+    BENCHMARK_STATS_FUNC("msg_send() burst msg_receive_many()", BENCH_RUNS,
+                         _send(burst));
 
     return 0;
 }
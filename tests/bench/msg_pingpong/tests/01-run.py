@@ -11,8 +11,16 @@ import sys
 from testrunner import run
 
 
+BENCHMARK_REGEXP = r'\{{"benchmark": "{func}", "unit": "\w+", .*\}}'
+
+
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(BENCHMARK_REGEXP.format(func=r"msg_send\(\) pingpong"))
+    child.expect(r"burst size: \d+")
+    child.expect(BENCHMARK_REGEXP.format(
+        func=r"msg_send\(\) burst msg_receive\(\)"))
+    child.expect(BENCHMARK_REGEXP.format(
+        func=r"msg_send\(\) burst msg_receive_many\(\)"))
 
 
 if __name__ == "__main__":
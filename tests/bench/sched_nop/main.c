@@ -19,44 +19,19 @@
  */
 
 #include <stdio.h>
-#include "macros/units.h"
-#include "clk.h"
-#include "thread.h"
 
-#include "xtimer.h"
+#include "benchmark.h"
+#include "thread.h"
 
-#ifndef TEST_DURATION
-#define TEST_DURATION       (1000000U)
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
 #endif
 
-volatile unsigned _flag = 0;
-
-static void _timer_callback(void*arg)
-{
-    (void)arg;
-
-    _flag = 1;
-}
-
 int main(void)
 {
     printf("main starting\n");
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
-
-    xtimer_set(&timer, TEST_DURATION);
-    while(!_flag) {
-        thread_yield();
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    BENCHMARK_STATS_FUNC("thread_yield()", BENCH_RUNS, thread_yield());
 
     return 0;
 }
@@ -22,9 +22,9 @@
 #include <string.h>
 
 #include "base64.h"
+#include "benchmark.h"
 #include "fmt.h"
 #include "macros/utils.h"
-#include "xtimer.h"
 
 static char buf[128];
 
@@ -35,8 +35,21 @@ static const char base64[128] =
 "VGhpcyBpcyBhbiBleHRyZW1lbHksIGVub3Jtb3VzbHksIGdyZWF0bHksIGltbWVuc2VseSwgdHJl"
 "bWVuZG91c2x5LCByZW1hcmthYmx5IGxlbmd0aHkgc2VudGVuY2Uh";
 
+static void _encode(void)
+{
+    size_t size = sizeof(buf);
+
+    base64_encode(input, sizeof(input), buf, &size);
+}
+
+static void _decode(void)
+{
+    size_t size = sizeof(buf);
+
+    base64_decode(base64, sizeof(base64), buf, &size);
+}
+
 int main(void) {
-    uint32_t start, stop;
     size_t size;
 
     /* We don't want check return value in the benchmark loop, so we just do
@@ -73,26 +86,7 @@ int main(void) {
         print_str("OK\n");
     }
 
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_encode(input, sizeof(input), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Encoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
-
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_decode(base64, sizeof(base64), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
+    BENCHMARK_STATS_FUNC("encode 96 bytes", 100, _encode());
+    BENCHMARK_STATS_FUNC("decode 128 bytes", 100, _decode());
     return 0;
 }
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare the word-wise Internet Checksum with the byte-wise
+ *              reference implementation
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/inet_csum.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (100UL)
+#endif
+
+static const uint16_t _sizes[] = { 8, 20, 64, 256, 1280 };
+static uint32_t _buf_u32[(1280 + 4) / sizeof(uint32_t)];
+static uint8_t *_buf = (uint8_t *)_buf_u32;
+static volatile uint16_t _sum;
+static char _name[24];
+
+/* the implementation of inet_csum_slice() before it summed whole words */
+static uint16_t _csum_bytewise(uint16_t sum, const uint8_t *buf, uint16_t len,
+                               size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    if (len == 0) {
+        return csum;
+    }
+    if (accum_len & 1) {
+        csum += *buf;
+        buf++;
+        len--;
+        accum_len++;
+    }
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if ((accum_len + len) & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+int main(void)
+{
+    puts("Internet checksum benchmark");
+    for (unsigned i = 0; i < sizeof(_buf_u32); i++) {
+        _buf[i] = (i * 7) & 0xff;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_sizes); i++) {
+        uint16_t len = _sizes[i];
+
+        for (unsigned offset = 0; offset < 2; offset++) {
+            const uint8_t *buf = &_buf[offset];
+
+            if (inet_csum(0, buf, len) != _csum_bytewise(0, buf, len, 0)) {
+                printf("[FAILED] checksums differ for %u bytes\n", len);
+                return 1;
+            }
+            printf("%u bytes, offset %u\n", len, offset);
+            snprintf(_name, sizeof(_name), "bytewise %u+%u", len, offset);
+            BENCHMARK_STATS_FUNC(_name, BENCH_RUNS,
+                                 _sum = _csum_bytewise(0, buf, len, 0));
+            snprintf(_name, sizeof(_name), "wordwise %u+%u", len, offset);
+            BENCHMARK_STATS_FUNC(_name, BENCH_RUNS,
+                                 _sum = inet_csum(0, buf, len));
+        }
+    }
+    puts("[SUCCESS]");
+    return 0;
+}
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 The RIOT developers
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+TIMEOUT = 60
+BENCHMARK_REGEXP = r'\{{"benchmark": "{func}", "unit": "\w+", .*\}}'
+
+
+def testfunc(child):
+    child.expect_exact('Internet checksum benchmark')
+    for size in (8, 20, 64, 256, 1280):
+        for offset in (0, 1):
+            child.expect_exact('{} bytes, offset {}'.format(size, offset))
+            for impl in ("bytewise", "wordwise"):
+                func = r"{} {}\+{}".format(impl, size, offset)
+                child.expect(BENCHMARK_REGEXP.format(func=func),
+                             timeout=TIMEOUT)
+    child.expect_exact('[SUCCESS]', timeout=TIMEOUT)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
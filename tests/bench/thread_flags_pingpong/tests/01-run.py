@@ -11,8 +11,11 @@ import sys
 from testrunner import run
 
 
+BENCHMARK_REGEXP = r'\{{"benchmark": "{func}", "unit": "\w+", .*\}}'
+
+
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(BENCHMARK_REGEXP.format(func=r"thread_flags_set\(\) pingpong"))
 
 
 if __name__ == "__main__":
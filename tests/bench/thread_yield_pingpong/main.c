@@ -20,25 +20,15 @@
 
 #include <stdio.h>
 
-#include "macros/units.h"
-#include "clk.h"
+#include "benchmark.h"
 #include "thread.h"
-#include "xtimer.h"
 
-#ifndef TEST_DURATION
-#define TEST_DURATION       (1000000U)
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000UL)
 #endif
 
-volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 
-static void _timer_callback(void*arg)
-{
-    (void)arg;
-
-    _flag = 1;
-}
-
 static void *_second_thread(void *arg)
 {
     (void)arg;
@@ -62,21 +52,7 @@ int main(void)
                   NULL,
                   "second_thread");
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
-
-    xtimer_set(&timer, TEST_DURATION);
-    while(!_flag) {
-        thread_yield();
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    BENCHMARK_STATS_FUNC("thread_yield() pingpong", BENCH_RUNS, thread_yield());
 
     return 0;
 }
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 
+#include "container.h"
 #include "test_utils/expect.h"
 
 #include "msg.h"
@@ -288,6 +289,42 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * test removing / setting middle timer REPEAT times with an increasing
+     * number of armed timers
+     *
+     */
+    static const unsigned armed[] = { 10, 100, 1000 };
+    for (unsigned i = 0; i < ARRAY_SIZE(armed); i++) {
+        unsigned numof = armed[i];
+        if (numof > NUMOF_TIMERS) {
+            break;
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        _base = BASE  - (before - start);
+        for (n = 0; n < numof; n++) {
+            _timer_set(n);
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        _base = BASE  - (before - start);
+        for (n = 0; n < REPEAT; n++) {
+            _timer_remove(numof / 2);
+            _timer_set(numof / 2);
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        printf("%25s %4u %8"PRIu32" / %u = %"PRIu32"\n", "remove() + set() of",
+               numof, diff, REPEAT, diff / REPEAT);
+        expect(!_triggers);
+
+        for (n = 0; n < numof; n++) {
+            _timer_remove(n);
+        }
+    }
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
     puts("done.");
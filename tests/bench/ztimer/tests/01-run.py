@@ -15,7 +15,10 @@ def testfunc(child):
     for i in range(13):
         child.expect(r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n")
 
-    child.expect_exact("done.\r\n")
+    # scaling with the number of armed timers, depending on NUMOF_TIMERS
+    while child.expect([r"\s+[\w() _\+]+\s+\d+ / \d+ = \d+\r\n",
+                        "done.\r\n"]) == 0:
+        pass
 
 
 if __name__ == "__main__":
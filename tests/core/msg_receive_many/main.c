@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   msg_receive_many test application
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+#define BUF_SIZE        (8U)
+
+static kernel_pid_t _main_pid;
+static msg_t _queue[QUEUE_SIZE];
+
+static char _stack_a[THREAD_STACKSIZE_MAIN];
+static char _stack_b[THREAD_STACKSIZE_MAIN];
+
+static void *_sender_a(void *arg)
+{
+    (void)arg;
+
+    /* fills the queue, then blocks on the 5th message */
+    for (uint32_t i = 0; i < QUEUE_SIZE + 2; i++) {
+        msg_t m = { .content.value = i };
+        msg_send(&m, _main_pid);
+    }
+
+    return NULL;
+}
+
+static void *_sender_b(void *arg)
+{
+    (void)arg;
+
+    msg_t m = { .content.value = 100 };
+    msg_send(&m, _main_pid);
+
+    return NULL;
+}
+
+static void _print(const msg_t *buf, int n)
+{
+    printf("received %d:", n);
+    for (int i = 0; i < n; i++) {
+        printf(" %" PRIu32, buf[i].content.value);
+    }
+    puts("");
+}
+
+int main(void)
+{
+    msg_t buf[BUF_SIZE];
+    int n;
+
+    puts("main starting");
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, QUEUE_SIZE);
+
+    thread_create(_stack_a, sizeof(_stack_a), THREAD_PRIORITY_MAIN - 1, 0,
+                  _sender_a, NULL, "sender_a");
+    thread_create(_stack_b, sizeof(_stack_b), THREAD_PRIORITY_MAIN - 1, 0,
+                  _sender_b, NULL, "sender_b");
+
+    /* four queued messages, then the ones of both blocked senders */
+    n = msg_receive_many(buf, BUF_SIZE, false);
+    _print(buf, n);
+
+    /* sender_a got unblocked and queued its last message */
+    n = msg_receive_many(buf, BUF_SIZE, false);
+    _print(buf, n);
+
+    n = msg_receive_many(buf, BUF_SIZE, false);
+    _print(buf, n);
+
+    puts("SUCCESS");
+
+    return 0;
+}
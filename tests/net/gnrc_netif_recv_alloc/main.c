@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests receiving into buffers allocated on demand when the
+ *              allocation fails
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define FIFO_SIZE       (4U)
+#define WAIT_MS         (100U)
+#define PAYLOAD_OFFSET  (sizeof(ethernet_hdr_t))
+
+/* broadcast frames of the local experimental ethertype */
+static const uint8_t _frame1[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0a,
+    0x88, 0xb5,
+    0xde, 0xad, 0xbe, 0xef,
+};
+static const uint8_t _frame2[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0a,
+    0x88, 0xb5,
+    0xca, 0xfe, 0xba, 0xbe, 0x00, 0x01,
+};
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[8];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+/* netdev_test driver with recv_alloc() */
+static netdev_driver_t _alloc_driver;
+static const netdev_driver_t *_driver;
+
+/* receive FIFO of the mock device */
+static const uint8_t *_fifo[FIFO_SIZE];
+static size_t _fifo_len[FIFO_SIZE];
+static volatile unsigned _fifo_head;
+static volatile unsigned _fifo_tail;
+
+static unsigned _alloc_calls;
+static size_t _alloc_len;
+static uint8_t _buf[ETHERNET_FRAME_LEN];
+
+static void _fifo_push(const uint8_t *frame, size_t len)
+{
+    expect(_fifo_tail - _fifo_head < FIFO_SIZE);
+    _fifo[_fifo_tail % FIFO_SIZE] = frame;
+    _fifo_len[_fifo_tail % FIFO_SIZE] = len;
+    _fifo_tail++;
+}
+
+static unsigned _fifo_numof(void)
+{
+    return _fifo_tail - _fifo_head;
+}
+
+static void _set_up(void)
+{
+    _fifo_head = 0;
+    _fifo_tail = 0;
+    _alloc_calls = 0;
+    _alloc_len = 0;
+}
+
+static void _tear_down(void)
+{
+    _mock_dev.netdev.netdev.driver = _driver;
+}
+
+static int _mock_netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (_fifo_numof() == 0) {
+        return 0;
+    }
+
+    size_t size = _fifo_len[_fifo_head % FIFO_SIZE];
+
+    if (buf == NULL) {
+        if (len > 0) {
+            /* drop the frame */
+            _fifo_head++;
+        }
+        return size;
+    }
+    if ((size_t)len < size) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _fifo[_fifo_head % FIFO_SIZE], size);
+    _fifo_head++;
+    return size;
+}
+
+/* reads the frame header only once and always advances the FIFO, as
+ * drivers of devices with an RX FIFO behind a bus do */
+static int _mock_netdev_recv_alloc(netdev_t *dev, netdev_rx_alloc_cb_t alloc,
+                                   void *arg, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (_fifo_numof() == 0) {
+        return 0;
+    }
+
+    size_t size = _fifo_len[_fifo_head % FIFO_SIZE];
+    uint8_t *buf = alloc(arg, size);
+
+    if (buf != NULL) {
+        memcpy(buf, _fifo[_fifo_head % FIFO_SIZE], size);
+    }
+    _fifo_head++;
+    return (buf != NULL) ? (int)size : -ENOBUFS;
+}
+
+static void _mock_netdev_isr(netdev_t *dev)
+{
+    for (unsigned i = _fifo_numof(); i > 0; i--) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _get_netdev_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static void *_alloc_fail(void *arg, size_t len)
+{
+    (void)arg;
+    _alloc_calls++;
+    _alloc_len = len;
+    return NULL;
+}
+
+static void *_alloc_buf(void *arg, size_t len)
+{
+    (void)arg;
+    _alloc_calls++;
+    _alloc_len = len;
+    return (len <= sizeof(_buf)) ? _buf : NULL;
+}
+
+/* a failed allocation drops the frame at the head of the FIFO, the next
+ * call gets the next frame */
+static void _test_recv_alloc_enobufs(void)
+{
+    netdev_t *dev = &_mock_dev.netdev.netdev;
+
+    _fifo_push(_frame1, sizeof(_frame1));
+    _fifo_push(_frame2, sizeof(_frame2));
+    TEST_ASSERT_EQUAL_INT(-ENOBUFS, netdev_recv_alloc(dev, _alloc_fail, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(1, _alloc_calls);
+    TEST_ASSERT_EQUAL_INT(sizeof(_frame1), _alloc_len);
+    TEST_ASSERT_EQUAL_INT(1, _fifo_numof());
+
+    TEST_ASSERT_EQUAL_INT(sizeof(_frame2), netdev_recv_alloc(dev, _alloc_buf, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(2, _alloc_calls);
+    TEST_ASSERT_EQUAL_INT(sizeof(_frame2), _alloc_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_buf, _frame2, sizeof(_frame2)));
+    TEST_ASSERT_EQUAL_INT(0, _fifo_numof());
+
+    /* nothing left to receive, no allocation */
+    TEST_ASSERT_EQUAL_INT(0, netdev_recv_alloc(dev, _alloc_buf, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(2, _alloc_calls);
+}
+
+static void test_netdev_recv_alloc__enobufs(void)
+{
+    _mock_dev.netdev.netdev.driver = &_alloc_driver;
+    _test_recv_alloc_enobufs();
+}
+
+static void test_netdev_recv_alloc__fallback_enobufs(void)
+{
+    _test_recv_alloc_enobufs();
+}
+
+static bool _wait_for_fifo_empty(void)
+{
+    for (unsigned i = 0; i < WAIT_MS; i++) {
+        if (_fifo_numof() == 0) {
+            return true;
+        }
+        ztimer_sleep(ZTIMER_MSEC, 1);
+    }
+    return (_fifo_numof() == 0);
+}
+
+/* fills the packet buffer, so no frame fits anymore */
+static gnrc_pktsnip_t *_pktbuf_fill(void)
+{
+    gnrc_pktsnip_t *fill = NULL;
+    gnrc_pktsnip_t *tmp;
+
+    while ((tmp = gnrc_pktbuf_add(fill, NULL, sizeof(_frame1),
+                                  GNRC_NETTYPE_UNDEF)) != NULL) {
+        fill = tmp;
+    }
+    expect(fill != NULL);
+    return fill;
+}
+
+static void _test_netif_recv_enobufs(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(
+                                        GNRC_NETREG_DEMUX_CTX_ALL,
+                                        thread_getpid());
+    gnrc_pktsnip_t *fill = _pktbuf_fill();
+    msg_t msg;
+
+    gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entry);
+
+    /* the frame is dropped while the packet buffer is full */
+    _fifo_push(_frame1, sizeof(_frame1));
+    netdev_trigger_event_isr(&_mock_dev.netdev.netdev);
+    TEST_ASSERT(_wait_for_fifo_empty());
+    gnrc_pktbuf_release(fill);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT_EQUAL_INT(-ETIME, ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg,
+                                                             WAIT_MS));
+
+    /* the next frame is received */
+    _fifo_push(_frame2, sizeof(_frame2));
+    netdev_trigger_event_isr(&_mock_dev.netdev.netdev);
+    TEST_ASSERT(ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, WAIT_MS) >= 0);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+
+    gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+    TEST_ASSERT_EQUAL_INT(sizeof(_frame2) - PAYLOAD_OFFSET, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(pkt->data, &_frame2[PAYLOAD_OFFSET],
+                                    pkt->size));
+    gnrc_pktbuf_release(pkt);
+    gnrc_netreg_unregister(GNRC_NETTYPE_UNDEF, &entry);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_recv__enobufs(void)
+{
+    _mock_dev.netdev.netdev.driver = &_alloc_driver;
+    _test_netif_recv_enobufs();
+}
+
+static void test_netif_recv__fallback_enobufs(void)
+{
+    _test_netif_recv_enobufs();
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netdev_recv_alloc__enobufs),
+        new_TestFixture(test_netdev_recv_alloc__fallback_enobufs),
+        new_TestFixture(test_netif_recv__enobufs),
+        new_TestFixture(test_netif_recv__fallback_enobufs),
+    };
+
+    EMB_UNIT_TESTCALLER(recv_alloc_tests, _set_up, _tear_down, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&recv_alloc_tests);
+    TESTS_END();
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_recv_cb(&_mock_dev, _mock_netdev_recv);
+    netdev_test_set_isr_cb(&_mock_dev, _mock_netdev_isr);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    _driver = _mock_dev.netdev.netdev.driver;
+    _alloc_driver = *_driver;
+    _alloc_driver.recv_alloc = _mock_netdev_recv_alloc;
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      THREAD_STACKSIZE_DEFAULT, GNRC_NETIF_PRIO,
+                                      "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    _init_mock_netif();
+    run_unittests();
+    return 0;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests adaptive polled reception of GNRC network interfaces
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/rx_poll.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define FRAMES_NUMOF    (10U)
+#define THRESHOLD       (4U)
+#define BUDGET          (3U)
+#define WAIT_MS         (5U * CONFIG_GNRC_NETIF_RX_POLL_INTERVAL_US / US_PER_MS)
+
+/* broadcast frame of the local experimental ethertype, dropped by GNRC */
+static const uint8_t _frame[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x3e, 0xe6, 0xb5, 0x22, 0xfd, 0x0a,
+    0x88, 0xb5,
+    0xde, 0xad, 0xbe, 0xef,
+};
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+
+static volatile unsigned _pending;
+static volatile unsigned _received;
+static volatile bool _rx_irq = true;
+
+static void _set_up(void)
+{
+    _received = 0;
+}
+
+static void _tear_down(void)
+{
+    gnrc_netif_rx_poll_set(&_netif, CONFIG_GNRC_NETIF_RX_POLL_THRESHOLD,
+                           CONFIG_GNRC_NETIF_RX_POLL_BUDGET);
+}
+
+static int _mock_netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (_pending == 0) {
+        return 0;
+    }
+    if (buf == NULL) {
+        if (len > 0) {
+            _pending--;
+        }
+        return sizeof(_frame);
+    }
+    if ((unsigned)len < sizeof(_frame)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, _frame, sizeof(_frame));
+    _pending--;
+    _received++;
+    return sizeof(_frame);
+}
+
+static void _mock_netdev_isr(netdev_t *dev)
+{
+    if (_rx_irq) {
+        /* an interrupt signals all frames received so far */
+        for (unsigned i = _pending; i > 0; i--) {
+            dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+        }
+    }
+    else if (_pending > 0) {
+        /* polled: at most one frame per call, see NETOPT_RX_END_IRQ */
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _set_netdev_rx_end_irq(netdev_t *dev, const void *value,
+                                  size_t value_len)
+{
+    (void)dev;
+    expect(value_len == sizeof(netopt_enable_t));
+    _rx_irq = (*((const netopt_enable_t *)value) == NETOPT_ENABLE);
+    return sizeof(netopt_enable_t);
+}
+
+static int _get_netdev_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static bool _wait_for(volatile unsigned *var, unsigned value)
+{
+    for (unsigned i = 0; i < WAIT_MS; i++) {
+        if (*var == value) {
+            return true;
+        }
+        ztimer_sleep(ZTIMER_MSEC, 1);
+    }
+    return (*var == value);
+}
+
+static void _receive_by_irq(void)
+{
+    _pending = FRAMES_NUMOF;
+    netdev_trigger_event_isr(&_mock_dev.netdev.netdev);
+    TEST_ASSERT(_wait_for(&_received, FRAMES_NUMOF));
+}
+
+static void test_rx_poll__threshold_zero(void)
+{
+    uint32_t to_poll = _netif.rx_poll.to_poll;
+
+    gnrc_netif_rx_poll_set(&_netif, 0, BUDGET);
+    _receive_by_irq();
+    TEST_ASSERT(!_netif.rx_poll.polling);
+    TEST_ASSERT(_rx_irq);
+    TEST_ASSERT_EQUAL_INT(to_poll, _netif.rx_poll.to_poll);
+}
+
+static void test_rx_poll__budget(void)
+{
+    uint32_t to_poll = _netif.rx_poll.to_poll;
+    uint32_t to_irq = _netif.rx_poll.to_irq;
+    unsigned rounds = 0;
+
+    gnrc_netif_rx_poll_set(&_netif, THRESHOLD, BUDGET);
+    /* exceeding the threshold in interrupt mode switches to polled mode */
+    _receive_by_irq();
+    TEST_ASSERT(_netif.rx_poll.polling);
+    TEST_ASSERT(!_rx_irq);
+    TEST_ASSERT_EQUAL_INT(to_poll + 1, _netif.rx_poll.to_poll);
+
+    /* the interface thread runs a poll round at once, so every change seen
+     * here is a single round, that must not exceed the budget */
+    _received = 0;
+    _pending = FRAMES_NUMOF;
+    while (_received < FRAMES_NUMOF) {
+        unsigned last = _received;
+
+        for (unsigned i = 0; (i < WAIT_MS) && (_received == last); i++) {
+            ztimer_sleep(ZTIMER_MSEC, 1);
+        }
+        TEST_ASSERT(_received > last);
+        TEST_ASSERT(_received - last <= BUDGET);
+        rounds++;
+    }
+    TEST_ASSERT(rounds >= (FRAMES_NUMOF + BUDGET - 1) / BUDGET);
+
+    /* a round without frames switches back to interrupt mode */
+    TEST_ASSERT(_wait_for((volatile unsigned *)&_netif.rx_poll.to_irq,
+                          to_irq + 1));
+    TEST_ASSERT(!_netif.rx_poll.polling);
+    TEST_ASSERT(_rx_irq);
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_rx_poll__threshold_zero),
+        new_TestFixture(test_rx_poll__budget),
+    };
+
+    EMB_UNIT_TESTCALLER(rx_poll_tests, _set_up, _tear_down, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&rx_poll_tests);
+    TESTS_END();
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_recv_cb(&_mock_dev, _mock_netdev_recv);
+    netdev_test_set_isr_cb(&_mock_dev, _mock_netdev_isr);
+    netdev_test_set_set_cb(&_mock_dev, NETOPT_RX_END_IRQ,
+                           _set_netdev_rx_end_irq);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      THREAD_STACKSIZE_DEFAULT, GNRC_NETIF_PRIO,
+                                      "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+    thread_yield_higher();
+}
+
+int main(void)
+{
+    _init_mock_netif();
+    run_unittests();
+    return 0;
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests burst transmission of GNRC network interfaces
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "iolist.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/neterr.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tx_sync.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define BURST           (CONFIG_GNRC_NETIF_TX_BURST_MAX)
+/* below the main thread, so send requests queue up at the interface */
+#define NETIF_PRIO      (THREAD_PRIORITY_MAIN + 1)
+
+static const uint8_t _payload[] = { 0xde, 0xad, 0xbe, 0xef };
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _main_msg_queue[8];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+/* netdev_test driver with send_burst() */
+static netdev_driver_t _burst_driver;
+static const netdev_driver_t *_driver;
+static gnrc_tx_sync_t _tx_sync[BURST];
+
+static unsigned _sends;
+static unsigned _fail_at;
+static unsigned _bursts;
+static unsigned _burst_numof;
+/* frames the device has room for in a burst */
+static unsigned _burst_room;
+
+static void _set_up(void)
+{
+    _sends = 0;
+    _fail_at = UINT_MAX;
+    _bursts = 0;
+    _burst_numof = 0;
+    _burst_room = BURST;
+    _mock_dev.netdev.netdev.driver = &_burst_driver;
+}
+
+static void _tear_down(void)
+{
+    _mock_dev.netdev.netdev.driver = _driver;
+}
+
+static int _mock_netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    if (_sends++ == _fail_at) {
+        return -EIO;
+    }
+    return iolist_size(iolist);
+}
+
+static int _mock_netdev_send_burst(netdev_t *dev, const iolist_t *const frames[],
+                                   unsigned numof)
+{
+    (void)dev;
+    (void)frames;
+    _bursts++;
+    _burst_numof = numof;
+    if (_burst_room == 0) {
+        return -EIO;
+    }
+    return (numof < _burst_room) ? numof : _burst_room;
+}
+
+static int _get_netdev_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+/* Queues numof send requests at the interface and collects the error
+ * reported for each of them. The packet at index bad has no destination. */
+static void _send_pkts(unsigned numof, unsigned bad, uint32_t *err)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload),
+                                              GNRC_NETTYPE_UNDEF);
+        gnrc_pktsnip_t *hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        gnrc_pktsnip_t *tx_sync = gnrc_tx_sync_build(&_tx_sync[i]);
+
+        expect((pkt != NULL) && (hdr != NULL) && (tx_sync != NULL));
+        if (i != bad) {
+            gnrc_netif_hdr_t *netif_hdr = hdr->data;
+
+            netif_hdr->flags |= GNRC_NETIF_HDR_FLAGS_BROADCAST;
+        }
+        /* the interface reports the result by releasing the TX sync snip */
+        expect(gnrc_neterr_reg(tx_sync) == 0);
+        pkt = gnrc_pkt_prepend(pkt, hdr);
+        gnrc_pkt_append(pkt, tx_sync);
+        expect(gnrc_netif_send(&_netif, pkt) > 0);
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        msg_t msg;
+
+        msg_receive(&msg);
+        expect(msg.type == GNRC_NETERR_MSG_TYPE);
+        err[i] = msg.content.value;
+    }
+}
+
+static void test_netdev_send_burst__fallback(void)
+{
+    iolist_t iol[BURST];
+    const iolist_t *frames[BURST];
+
+    _mock_dev.netdev.netdev.driver = _driver;
+    for (unsigned i = 0; i < BURST; i++) {
+        iol[i].iol_next = NULL;
+        iol[i].iol_base = (void *)_payload;
+        iol[i].iol_len = sizeof(_payload);
+        frames[i] = &iol[i];
+    }
+    TEST_ASSERT_EQUAL_INT(BURST, netdev_send_burst(&_mock_dev.netdev.netdev,
+                                                   frames, BURST));
+    TEST_ASSERT_EQUAL_INT(BURST, _sends);
+
+    /* an error in the middle ends the burst */
+    _sends = 0;
+    _fail_at = 1;
+    TEST_ASSERT_EQUAL_INT(1, netdev_send_burst(&_mock_dev.netdev.netdev,
+                                               frames, BURST));
+    TEST_ASSERT_EQUAL_INT(2, _sends);
+
+    /* an error on the first frame is returned */
+    _sends = 0;
+    _fail_at = 0;
+    TEST_ASSERT_EQUAL_INT(-EIO, netdev_send_burst(&_mock_dev.netdev.netdev,
+                                                  frames, BURST));
+    TEST_ASSERT_EQUAL_INT(1, _sends);
+}
+
+static void test_netif_send_burst(void)
+{
+    uint32_t err[BURST];
+
+    _send_pkts(BURST, UINT_MAX, err);
+    TEST_ASSERT_EQUAL_INT(1, _bursts);
+    TEST_ASSERT_EQUAL_INT(BURST, _burst_numof);
+    TEST_ASSERT_EQUAL_INT(0, _sends);
+    for (unsigned i = 0; i < BURST; i++) {
+        TEST_ASSERT_EQUAL_INT(GNRC_NETERR_SUCCESS, err[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_send_burst__partial(void)
+{
+    uint32_t err[BURST];
+
+    /* frames the device has no room for are reported busy */
+    _burst_room = BURST / 2;
+    _send_pkts(BURST, UINT_MAX, err);
+    TEST_ASSERT_EQUAL_INT(1, _bursts);
+    TEST_ASSERT_EQUAL_INT(BURST, _burst_numof);
+    for (unsigned i = 0; i < BURST; i++) {
+        TEST_ASSERT_EQUAL_INT((i < BURST / 2) ? GNRC_NETERR_SUCCESS : EBUSY,
+                              err[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_send_burst__error(void)
+{
+    uint32_t err[BURST];
+
+    /* the error of the first frame is reported, the others were not sent */
+    _burst_room = 0;
+    _send_pkts(BURST, UINT_MAX, err);
+    TEST_ASSERT_EQUAL_INT(1, _bursts);
+    TEST_ASSERT_EQUAL_INT(EIO, err[0]);
+    for (unsigned i = 1; i < BURST; i++) {
+        TEST_ASSERT_EQUAL_INT(EBUSY, err[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_send_burst__bad_pkt(void)
+{
+    uint32_t err[BURST];
+
+    /* a packet without destination in the middle is left out of the burst */
+    _send_pkts(BURST, 1, err);
+    TEST_ASSERT_EQUAL_INT(1, _bursts);
+    TEST_ASSERT_EQUAL_INT(BURST - 1, _burst_numof);
+    for (unsigned i = 0; i < BURST; i++) {
+        TEST_ASSERT_EQUAL_INT((i == 1) ? EBADMSG : GNRC_NETERR_SUCCESS,
+                              err[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_netif_send_burst__fallback(void)
+{
+    uint32_t err[BURST];
+
+    /* without send_burst() every frame goes through send(), the burst ends
+     * at the first error */
+    _mock_dev.netdev.netdev.driver = _driver;
+    _fail_at = 2;
+    _send_pkts(BURST, UINT_MAX, err);
+    TEST_ASSERT_EQUAL_INT(0, _bursts);
+    TEST_ASSERT_EQUAL_INT(3, _sends);
+    for (unsigned i = 0; i < BURST; i++) {
+        TEST_ASSERT_EQUAL_INT((i < 2) ? GNRC_NETERR_SUCCESS : EBUSY, err[i]);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_netdev_send_burst__fallback),
+        new_TestFixture(test_netif_send_burst),
+        new_TestFixture(test_netif_send_burst__partial),
+        new_TestFixture(test_netif_send_burst__error),
+        new_TestFixture(test_netif_send_burst__bad_pkt),
+        new_TestFixture(test_netif_send_burst__fallback),
+    };
+
+    EMB_UNIT_TESTCALLER(tx_burst_tests, _set_up, _tear_down, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&tx_burst_tests);
+    TESTS_END();
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_send_cb(&_mock_dev, _mock_netdev_send);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    _driver = _mock_dev.netdev.netdev.driver;
+    _burst_driver = *_driver;
+    _burst_driver.send_burst = _mock_netdev_send_burst;
+    expect(gnrc_netif_ethernet_create(&_netif, _mock_netif_stack,
+                                      THREAD_STACKSIZE_DEFAULT, NETIF_PRIO,
+                                      "mock_netif",
+                                      &_mock_dev.netdev.netdev) == 0);
+}
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, ARRAY_SIZE(_main_msg_queue));
+    _init_mock_netif();
+    run_unittests();
+    return 0;
+}
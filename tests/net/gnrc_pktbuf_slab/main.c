@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the size class implementation of the packet buffer
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "pktbuf_slab.h"
+
+#define SMALL_DATA_SIZE     (CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE - 8)
+#define LARGE_DATA_SIZE     (CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+static uint8_t _data[LARGE_DATA_SIZE];
+
+static unsigned _used(gnrc_pktbuf_slab_class_t cls)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+
+    gnrc_pktbuf_slab_get_stats(cls, &stats);
+    return stats.used;
+}
+
+static unsigned _size(gnrc_pktbuf_slab_class_t cls)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+
+    gnrc_pktbuf_slab_get_stats(cls, &stats);
+    return stats.size;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i & 0xff;
+    }
+}
+
+static void test_pktbuf_slab_add__classes(void)
+{
+    gnrc_pktsnip_t *hdr, *small, *large;
+
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_add(NULL, _data, 8,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((small = gnrc_pktbuf_add(hdr, _data, SMALL_DATA_SIZE,
+                                                  GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((large = gnrc_pktbuf_add(small, _data, LARGE_DATA_SIZE,
+                                                  GNRC_NETTYPE_TEST)));
+    /* 3 snips and the 8 byte header in the snip class */
+    TEST_ASSERT_EQUAL_INT(4, _used(GNRC_PKTBUF_SLAB_SNIP));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, large->data, LARGE_DATA_SIZE));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(large);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__too_large(void)
+{
+    gnrc_pktbuf_slab_stats_t stats;
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, LARGE_DATA_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_slab_get_stats(GNRC_PKTBUF_SLAB_LARGE, &stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.fails);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__fallback_and_fail(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    gnrc_pktbuf_slab_stats_t stats;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, NULL, SMALL_DATA_SIZE,
+                                                    GNRC_NETTYPE_TEST)));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+                          _used(GNRC_PKTBUF_SLAB_SMALL));
+    /* small class exhausted, the large class takes over */
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, NULL, SMALL_DATA_SIZE,
+                                                    GNRC_NETTYPE_TEST)));
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(pkt, NULL, SMALL_DATA_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_slab_get_stats(GNRC_PKTBUF_SLAB_SMALL, &stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF, stats.fallbacks);
+    TEST_ASSERT_EQUAL_INT(1, stats.fails);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF, stats.max_used);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_mark__in_place(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _data, LARGE_DATA_SIZE,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF)));
+    /* data is not moved */
+    TEST_ASSERT((uint8_t *)pkt->data == ((uint8_t *)hdr->data) + 8);
+    TEST_ASSERT_EQUAL_INT(LARGE_DATA_SIZE - 8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[8], pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_LARGE));
+    /* object is kept as long as one of the sections is in use */
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[8], pkt->data, pkt->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_mark__unaligned(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _data, LARGE_DATA_SIZE,
+                                                GNRC_NETTYPE_TEST)));
+    data = pkt->data;
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 3, GNRC_NETTYPE_UNDEF)));
+    /* the marked section stays, the rest is moved to an aligned object */
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT(pkt->data != ((uint8_t *)hdr->data) + 3);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)pkt->data % GNRC_PKTBUF_SLAB_ALIGN);
+    TEST_ASSERT_EQUAL_INT(LARGE_DATA_SIZE - 3, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, hdr->data, hdr->size));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[3], pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(2, _used(GNRC_PKTBUF_SLAB_LARGE));
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_realloc_data__in_place(void)
+{
+    gnrc_pktsnip_t *pkt;
+    void *data;
+
+    /* just too large for the snip class */
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _data,
+                                                _size(GNRC_PKTBUF_SLAB_SNIP) + 1,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_SMALL));
+    data = pkt->data;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 8));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, SMALL_DATA_SIZE));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, 8));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_realloc_data__move(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, _data, SMALL_DATA_SIZE,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 8, GNRC_NETTYPE_UNDEF)));
+    /* the object is shared with hdr, so it must not be grown in place */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 16));
+    TEST_ASSERT((uint8_t *)hdr->data != ((uint8_t *)pkt->data) - 8);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, hdr->data, 8));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[8], pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, LARGE_DATA_SIZE));
+    TEST_ASSERT_EQUAL_INT(1, _used(GNRC_PKTBUF_SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[8], pkt->data, SMALL_DATA_SIZE - 8));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_merge(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(NULL, &_data[8],
+                                                SMALL_DATA_SIZE,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_pktbuf_add(pkt, _data, 8,
+                                                GNRC_NETTYPE_TEST)));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_merge(pkt));
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(SMALL_DATA_SIZE + 8, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, pkt->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_gnrc_pktbuf_slab(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_add__classes),
+        new_TestFixture(test_pktbuf_slab_add__too_large),
+        new_TestFixture(test_pktbuf_slab_add__fallback_and_fail),
+        new_TestFixture(test_pktbuf_slab_mark__in_place),
+        new_TestFixture(test_pktbuf_slab_mark__unaligned),
+        new_TestFixture(test_pktbuf_slab_realloc_data__in_place),
+        new_TestFixture(test_pktbuf_slab_realloc_data__move),
+        new_TestFixture(test_pktbuf_slab_merge),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_slab());
+    TESTS_END();
+
+    return 0;
+}
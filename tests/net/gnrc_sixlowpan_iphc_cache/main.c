@@ -0,0 +1,304 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the flow cache of the 6LoWPAN IPHC encoder
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "mutex.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan/ctx.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define SEND_PACKET_TIMEOUT     (500U)
+
+#define LOC_L2          { 0xb8, 0x8c, 0xcc, 0xba, 0xef, 0x9a, 0x67, 0x42 }
+#define REM_L2          { 0xb8, 0x8c, 0xcc, 0xba, 0xef, 0x9a, 0x67, 0x43 }
+#define LOC_IID         0xba, 0x8c, 0xcc, 0xba, 0xef, 0x9a, 0x67, 0x42
+#define REM_IID         0xba, 0x8c, 0xcc, 0xba, 0xef, 0x9a, 0x67, 0x43
+#define LOC_LL          { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, LOC_IID }
+#define LOC_GB          { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, LOC_IID }
+#define REM_LL          { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, REM_IID }
+/* unicast-prefix-based multicast address (RFC 3306) for 2001:db8:0:1::/64 */
+#define REM_UPB_MC      { 0xff, 0x3e, 0x00, 0x40, 0x20, 0x01, 0x0d, 0xb8, \
+                          0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42 }
+#define GB_PFX          { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00 }
+#define UPB_MC_PFX      { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01 }
+#define PAYLOAD         0xde, 0xad, 0xbe, 0xef
+
+#define CTX_LTIME       (60U)
+#define UPB_MC_CTX_ID   (1U)
+
+static const uint8_t _loc_l2[] = LOC_L2;
+static const uint8_t _rem_l2[] = REM_L2;
+static const ipv6_addr_t _loc_ll = { .u8 = LOC_LL };
+static const ipv6_addr_t _loc_gb = { .u8 = LOC_GB };
+static const ipv6_addr_t _rem_ll = { .u8 = REM_LL };
+static const ipv6_addr_t _rem_upb_mc = { .u8 = REM_UPB_MC };
+static const ipv6_addr_t _gb_pfx = { .u8 = GB_PFX };
+static const ipv6_addr_t _upb_mc_pfx = { .u8 = UPB_MC_PFX };
+static const uint8_t _payload[] = { PAYLOAD };
+
+/* IPHC: TF: 0b11 (elided), NH: 0b0 (inline), HLIM: 0b10 (64) */
+#define IPHC1           (0x7a)
+
+/* Source: fe80::/64 derived from L2 (SAC: 0b0, SAM: 0b11),
+ * Destination: fe80::/64 derived from L2 (M: 0b0, DAC: 0b0, DAM: 0b11) */
+static const uint8_t _exp_ll[] = {
+    IPHC1, 0x33, PROTNUM_IPV6_NONXT,
+    PAYLOAD,
+};
+
+/* Source: inline (SAC: 0b0, SAM: 0b00),
+ * Destination: fe80::/64 derived from L2 (M: 0b0, DAC: 0b0, DAM: 0b11) */
+static const uint8_t _exp_gb_stateless[] = {
+    IPHC1, 0x03, PROTNUM_IPV6_NONXT,
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, LOC_IID,
+    PAYLOAD,
+};
+
+/* Source: context 0 derived from L2 (SAC: 0b1, SAM: 0b11),
+ * Destination: fe80::/64 derived from L2 (M: 0b0, DAC: 0b0, DAM: 0b11) */
+static const uint8_t _exp_gb_stateful[] = {
+    IPHC1, 0x73, PROTNUM_IPV6_NONXT,
+    PAYLOAD,
+};
+
+/* CID: 0b1, Source: fe80::/64 derived from L2 (SAC: 0b0, SAM: 0b11),
+ * Destination: unicast-prefix-based multicast (M: 0b1, DAC: 0b1, DAM: 0b00),
+ * SCI: 0, DCI: UPB_MC_CTX_ID, flags, scope, RIID and group ID inline */
+static const uint8_t _exp_upb_mc[] = {
+    IPHC1, 0xbc, UPB_MC_CTX_ID, PROTNUM_IPV6_NONXT,
+    0x3e, 0x00, 0x00, 0x00, 0x00, 0x42,
+    PAYLOAD,
+};
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+static gnrc_netif_t *_mock_netif;
+
+static uint8_t _frame[128U];
+static size_t _frame_len;
+static mutex_t _frame_sent = MUTEX_INIT_LOCKED;
+
+static void _set_up(void)
+{
+    mutex_trylock(&_frame_sent);
+    _frame_len = 0;
+}
+
+static void _tear_down(void)
+{
+    gnrc_sixlowpan_ctx_reset();
+}
+
+static int _mock_netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    _frame_len = 0;
+    for (const iolist_t *ptr = iolist; ptr != NULL; ptr = ptr->iol_next) {
+        if ((_frame_len + ptr->iol_len) > sizeof(_frame)) {
+            return -ENOBUFS;
+        }
+        memcpy(&_frame[_frame_len], ptr->iol_base, ptr->iol_len);
+        _frame_len += ptr->iol_len;
+    }
+    mutex_unlock(&_frame_sent);
+    return _frame_len;
+}
+
+static void _send(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                  const uint8_t *dst_l2, size_t dst_l2_len)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    ipv6_hdr_t *ipv6_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, _payload, sizeof(_payload), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    pkt = gnrc_ipv6_hdr_build(pkt, src, dst);
+    TEST_ASSERT_NOT_NULL(pkt);
+    ipv6_hdr = pkt->data;
+    ipv6_hdr->len = byteorder_htons(sizeof(_payload));
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = 64;
+    netif = gnrc_netif_hdr_build(NULL, 0, dst_l2, dst_l2_len);
+    TEST_ASSERT_NOT_NULL(netif);
+    gnrc_netif_hdr_set_netif(netif->data, _mock_netif);
+    if (dst_l2_len == 0) {
+        ((gnrc_netif_hdr_t *)netif->data)->flags |= GNRC_NETIF_HDR_FLAGS_MULTICAST;
+    }
+    netif->next = pkt;
+    TEST_ASSERT(0 < gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                              GNRC_NETREG_DEMUX_CTX_ALL,
+                                              netif));
+}
+
+static void _check_frame(const uint8_t *exp, size_t exp_len)
+{
+    size_t mhr_len;
+
+    TEST_ASSERT_EQUAL_INT(0, xtimer_mutex_lock_timeout(&_frame_sent,
+                                                       SEND_PACKET_TIMEOUT));
+    TEST_ASSERT((mhr_len = ieee802154_get_frame_hdr_len(_frame)));
+    TEST_ASSERT_EQUAL_INT(exp_len, _frame_len - mhr_len);
+    TEST_ASSERT_MESSAGE(memcmp(exp, &_frame[mhr_len], exp_len) == 0,
+                        "unexpected IPHC header");
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_iphc_cache__hit(void)
+{
+    /* the first packet fills the cache, the second one hits */
+    for (unsigned i = 0; i < 2; i++) {
+        _send(&_loc_ll, &_rem_ll, _rem_l2, sizeof(_rem_l2));
+        _check_frame(_exp_ll, sizeof(_exp_ll));
+    }
+}
+
+static void test_iphc_cache__ctx_update(void)
+{
+    _send(&_loc_gb, &_rem_ll, _rem_l2, sizeof(_rem_l2));
+    _check_frame(_exp_gb_stateless, sizeof(_exp_gb_stateless));
+    /* a new context must invalidate the cached stateless compression */
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(0, &_gb_pfx, 64, CTX_LTIME,
+                                                   true));
+    _send(&_loc_gb, &_rem_ll, _rem_l2, sizeof(_rem_l2));
+    _check_frame(_exp_gb_stateful, sizeof(_exp_gb_stateful));
+}
+
+static void test_iphc_cache__ctx_lifetime_expired(void)
+{
+    gnrc_sixlowpan_ctx_t *ctx = gnrc_sixlowpan_ctx_update(0, &_gb_pfx, 64,
+                                                          CTX_LTIME, true);
+
+    TEST_ASSERT_NOT_NULL(ctx);
+    _send(&_loc_gb, &_rem_ll, _rem_l2, sizeof(_rem_l2));
+    _check_frame(_exp_gb_stateful, sizeof(_exp_gb_stateful));
+    /* let the lifetime run out: the next lookup of the context removes its
+     * compression flag, without the cache being invalidated */
+    ctx->ltime = 0;
+    _send(&_loc_gb, &_rem_ll, _rem_l2, sizeof(_rem_l2));
+    _check_frame(_exp_gb_stateless, sizeof(_exp_gb_stateless));
+}
+
+static void test_iphc_cache__upb_multicast_cid(void)
+{
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_ctx_update(UPB_MC_CTX_ID, &_upb_mc_pfx,
+                                                   64, CTX_LTIME, true));
+    /* the CID extension needs to be part of both a miss and a hit */
+    for (unsigned i = 0; i < 2; i++) {
+        _send(&_loc_ll, &_rem_upb_mc, NULL, 0);
+        _check_frame(_exp_upb_mc, sizeof(_exp_upb_mc));
+    }
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_iphc_cache__hit),
+        new_TestFixture(test_iphc_cache__ctx_update),
+        new_TestFixture(test_iphc_cache__ctx_lifetime_expired),
+        new_TestFixture(test_iphc_cache__upb_multicast_cid),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_iphc_cache_tests, _set_up, _tear_down, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_iphc_cache_tests);
+    TESTS_END();
+}
+
+static int _get_netdev_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(gnrc_nettype_t));
+    (void)netdev;
+
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *netdev, void *value,
+                                    size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+
+    *((uint16_t *)value) = 102U;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_loc_l2);
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_loc_l2));
+    memcpy(value, _loc_l2, sizeof(_loc_l2));
+    return sizeof(_loc_l2);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_PROTO,
+                           _get_netdev_proto);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_SRC_LEN,
+                           _get_netdev_src_len);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS_LONG,
+                           _get_netdev_addr_long);
+    netdev_test_set_send_cb(&_mock_dev, _mock_netdev_send);
+    gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                 THREAD_STACKSIZE_DEFAULT, GNRC_NETIF_PRIO,
+                                 "mock_netif", &_mock_dev.netdev.netdev);
+    _mock_netif = &_netif;
+    thread_yield_higher();
+}
+
+int main(void)
+{
+    _init_mock_netif();
+    run_unittests();
+    return 0;
+}
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "xtimer.h"
@@ -518,6 +519,73 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_many__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t results[3];
+    sock_udp_mmsg_t msgs[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].data = &_test_buffer[i * (sizeof(_test_buffer) / ARRAY_SIZE(msgs))];
+        msgs[i].len = sizeof(_test_buffer) / ARRAY_SIZE(msgs);
+        msgs[i].remote = &results[i];
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == results[0].port);
+    expect(sizeof("EFG") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EFG", sizeof("EFG")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == results[1].port);
+    expect(AF_INET6 == results[1].family);
+    expect(memcmp(&results[1].addr, &src_addr, sizeof(results[1].addr)) == 0);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_many__drop_too_large(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    static uint8_t large[(sizeof(_test_buffer) / 3) + 1];
+    sock_udp_mmsg_t msgs[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].data = &_test_buffer[i * (sizeof(_test_buffer) / ARRAY_SIZE(msgs))];
+        msgs[i].len = sizeof(_test_buffer) / ARRAY_SIZE(msgs);
+        msgs[i].remote = NULL;
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, large, sizeof(large),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                          _TEST_NETIF));
+    /* the datagram not fitting into its space is dropped */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(sizeof("EFG") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EFG", sizeof("EFG")) == 0);
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -685,6 +753,39 @@ static void test_sock_udp_sendv__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_many__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t other_remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                   .family = AF_INET6,
+                                   .port = _TEST_PORT_REMOTE + 1 };
+    sock_udp_mmsg_t msgs[] = {
+        { .data = "ABCD", .len = sizeof("ABCD"), .remote = NULL },
+        { .data = "EFG", .len = sizeof("EFG"), .remote = &other_remote },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(2 == sock_udp_send_many(&_sock, msgs, ARRAY_SIZE(msgs)));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(sizeof("EFG") == msgs[1].msg_len);
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "EFG", sizeof("EFG"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -855,6 +956,8 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_many__success());
+    CALL(test_sock_udp_recv_many__drop_too_large());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -866,6 +969,7 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
     CALL(test_sock_udp_sendv__socketed());
+    CALL(test_sock_udp_send_many__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
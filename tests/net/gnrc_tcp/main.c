@@ -6,23 +6,33 @@
  * directory for more details.
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
+#include "container.h"
 #include "shell.h"
 #include "msg.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/af.h"
 #include "net/gnrc/tcp.h"
+#include "net/gnrc/tcp/congestion.h"
 
 #define MAIN_QUEUE_SIZE (8)
 #define TCB_QUEUE_SIZE (1)
 #define BUFFER_SIZE (2049)
+#define SEND_IOLIST_MAX (8)
 
 static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
 static gnrc_tcp_tcb_t tcbs[TCB_QUEUE_SIZE];
 static gnrc_tcp_tcb_t *tcb = tcbs;
 static gnrc_tcp_tcb_queue_t queue = GNRC_TCP_TCB_QUEUE_INIT;
 static char buffer[BUFFER_SIZE];
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+static congure_abe_snd_t congures[TCB_QUEUE_SIZE];
+#elif IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+static congure_reno_snd_t congures[TCB_QUEUE_SIZE];
+#endif
 
 void dump_args(int argc, char **argv)
 {
@@ -129,6 +139,13 @@ int gnrc_tcp_tcb_init_cmd(int argc, char **argv)
     for (int i = 0; i < TCB_QUEUE_SIZE; ++i)
     {
         gnrc_tcp_tcb_init(&(tcbs[i]));
+#if IS_USED(MODULE_GNRC_TCP_CONGURE_ABE)
+        gnrc_tcp_congure_abe_setup(&(congures[i]));
+        gnrc_tcp_tcb_set_congure(&(tcbs[i]), &(congures[i].super));
+#elif IS_USED(MODULE_GNRC_TCP_CONGURE_RENO)
+        gnrc_tcp_congure_reno_setup(&(congures[i]));
+        gnrc_tcp_tcb_set_congure(&(tcbs[i]), &(congures[i].super));
+#endif
     }
     printf("%s: returns 0\n", argv[0]);
     return 0;
@@ -178,6 +195,33 @@ int gnrc_tcp_open_cmd(int argc, char **argv)
     return err;
 }
 
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN)
+int gnrc_tcp_open_fastopen_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    gnrc_tcp_ep_t remote;
+    gnrc_tcp_ep_from_str(&remote, argv[1]);
+    uint16_t local_port = atol(argv[2]);
+    size_t len = atol(argv[3]);
+
+    ssize_t ret = gnrc_tcp_open_fastopen(tcb, &remote, local_port, buffer, len);
+    switch (ret) {
+        case -ETIMEDOUT:
+            printf("%s: returns -ETIMEOUT\n", argv[0]);
+            break;
+
+        case -ECONNREFUSED:
+            printf("%s: returns -ECONNREFUSED\n", argv[0]);
+            break;
+
+        default:
+            printf("%s: returns %d\n", argv[0], (int)ret);
+    }
+    return (ret < 0) ? ret : 0;
+}
+#endif
+
 int gnrc_tcp_listen_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -185,7 +229,16 @@ int gnrc_tcp_listen_cmd(int argc, char **argv)
     gnrc_tcp_ep_t local;
     gnrc_tcp_ep_from_str(&local, argv[1]);
 
-    int err = gnrc_tcp_listen(&queue, tcbs, ARRAY_SIZE(tcbs), &local);
+    int err;
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN)
+    if (strcmp(argv[0], "gnrc_tcp_listen_fastopen") == 0) {
+        err = gnrc_tcp_listen_fastopen(&queue, tcbs, ARRAY_SIZE(tcbs), &local);
+    }
+    else
+#endif
+    {
+        err = gnrc_tcp_listen(&queue, tcbs, ARRAY_SIZE(tcbs), &local);
+    }
     switch (err) {
         case -EAFNOSUPPORT:
             printf("%s: returns -EAFNOSUPPORT\n", argv[0]);
@@ -244,6 +297,32 @@ int gnrc_tcp_accept_cmd(int argc, char **argv)
     return err;
 }
 
+static int _print_send_error(const char *cmd, int ret)
+{
+    switch (ret) {
+        case 0:
+            printf("%s: returns 0\n", cmd);
+            return 1;
+
+        case -ENOTCONN:
+            printf("%s: returns -ENOTCONN\n", cmd);
+            return 1;
+
+        case -ECONNRESET:
+            printf("%s: returns -ECONNRESET\n", cmd);
+            return 1;
+
+        case -ECONNABORTED:
+            printf("%s: returns -ECONNABORTED\n", cmd);
+            return 1;
+
+        case -ETIMEDOUT:
+            printf("%s: returns -ETIMEDOUT\n", cmd);
+            return 1;
+    }
+    return 0;
+}
+
 int gnrc_tcp_send_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -254,26 +333,90 @@ int gnrc_tcp_send_cmd(int argc, char **argv)
 
     do {
         int ret = gnrc_tcp_send(tcb, buffer + sent, to_send - sent, timeout);
-        switch (ret) {
-            case 0:
-                printf("%s: returns 0\n", argv[0]);
-                return ret;
+        if (_print_send_error(argv[0], ret)) {
+            return ret;
+        }
+        sent += ret;
+    } while (sent < to_send);
 
-            case -ENOTCONN:
-                printf("%s: returns -ENOTCONN\n", argv[0]);
-                return ret;
+    printf("%s: sent %u\n", argv[0], (unsigned)sent);
+    return sent;
+}
 
-            case -ECONNRESET:
-                printf("%s: returns -ECONNRESET\n", argv[0]);
-                return ret;
+int gnrc_tcp_send_iolist_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
 
-            case -ECONNABORTED:
-                printf("%s: returns -ECONNABORTED\n", argv[0]);
-                return ret;
+    size_t timeout = atol(argv[1]);
+    size_t to_send = atol(argv[2]);
+    size_t elems = atol(argv[3]);
+    size_t sent = 0;
+    iolist_t iol[SEND_IOLIST_MAX];
 
-            case -ETIMEDOUT:
-                printf("%s: returns -ETIMEDOUT\n", argv[0]);
-                return ret;
+    if (elems == 0 || elems > ARRAY_SIZE(iol)) {
+        printf("%s: returns -EINVAL\n", argv[0]);
+        return -EINVAL;
+    }
+
+    do {
+        /* Spread the unsent data evenly over the elements, the last one
+         * takes the remainder */
+        size_t left = to_send - sent;
+        size_t elem_len = left / elems;
+        char *pos = buffer + sent;
+
+        for (size_t i = 0; i < elems; i++) {
+            iol[i].iol_base = pos;
+            iol[i].iol_len = (i == elems - 1) ? left - (i * elem_len) : elem_len;
+            iol[i].iol_next = (i == elems - 1) ? NULL : &iol[i + 1];
+            pos += iol[i].iol_len;
+        }
+
+        int ret = gnrc_tcp_send_iolist(tcb, iol, timeout);
+        if (_print_send_error(argv[0], ret)) {
+            return ret;
+        }
+        sent += ret;
+    } while (sent < to_send);
+
+    printf("%s: sent %u\n", argv[0], (unsigned)sent);
+    return sent;
+}
+
+int gnrc_tcp_send_pkt_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    size_t timeout = atol(argv[1]);
+    size_t to_send = atol(argv[2]);
+    size_t snip_size = atol(argv[3]);
+    size_t sent = 0;
+    gnrc_pktsnip_t *pkt = NULL;
+
+    if (snip_size == 0) {
+        printf("%s: returns -EINVAL\n", argv[0]);
+        return -EINVAL;
+    }
+
+    /* Build the payload back to front, the first snip may be shorter */
+    for (size_t end = to_send; end > 0;) {
+        size_t len = (end % snip_size) ? end % snip_size : snip_size;
+        gnrc_pktsnip_t *snp = gnrc_pktbuf_add(pkt, buffer + end - len, len,
+                                              GNRC_NETTYPE_UNDEF);
+        if (snp == NULL) {
+            gnrc_pktbuf_release(pkt);
+            printf("%s: returns -ENOMEM\n", argv[0]);
+            return -ENOMEM;
+        }
+        pkt = snp;
+        end -= len;
+    }
+
+    do {
+        int ret = gnrc_tcp_send_pkt(tcb, &pkt, timeout);
+        if (_print_send_error(argv[0], ret)) {
+            gnrc_pktbuf_release(pkt);
+            return ret;
         }
         sent += ret;
     } while (sent < to_send);
@@ -421,6 +564,19 @@ int gnrc_tcp_queue_get_local_cmd(int argc, char **argv)
     return 0;
 }
 
+int gnrc_tcp_get_rcvbuf_stats_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+    gnrc_tcp_rcvbuf_stats_t stats;
+
+    gnrc_tcp_get_rcvbuf_stats(tcb, &stats);
+    printf("%s: returns\n", argv[0]);
+    printf("Stats: size=%" PRIu32 " size_max=%" PRIu32 " avail=%" PRIu32 " read=%" PRIu32
+           " grown=%u shrunk=%u grow_failed=%u\n", stats.size, stats.size_max, stats.avail,
+           stats.read, stats.grown, stats.shrunk, stats.grow_failed);
+    return 0;
+}
+
 /* Exporting GNRC TCP Api to for shell usage */
 static const shell_command_t shell_commands[] = {
     { "gnrc_tcp_ep_from_str", "Build endpoint from string",
@@ -429,12 +585,23 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_tcb_init_cmd },
     { "gnrc_tcp_open", "gnrc_tcp: open connection",
       gnrc_tcp_open_cmd },
+#if IS_USED(MODULE_GNRC_TCP_FASTOPEN)
+    { "gnrc_tcp_open_fastopen", "gnrc_tcp: open connection, send buffer along with SYN",
+      gnrc_tcp_open_fastopen_cmd },
+#endif
     { "gnrc_tcp_listen", "gnrc_tcp: listen for connection",
       gnrc_tcp_listen_cmd },
+    { "gnrc_tcp_listen_fastopen",
+      "gnrc_tcp: listen for connection, accept TCP Fast Open if available",
+      gnrc_tcp_listen_cmd },
     { "gnrc_tcp_accept", "gnrc_tcp: accept connection",
       gnrc_tcp_accept_cmd },
     { "gnrc_tcp_send", "gnrc_tcp: send data to connected peer",
       gnrc_tcp_send_cmd },
+    { "gnrc_tcp_send_iolist", "gnrc_tcp: send data split over an iolist",
+      gnrc_tcp_send_iolist_cmd },
+    { "gnrc_tcp_send_pkt", "gnrc_tcp: send data held in a chain of snips",
+      gnrc_tcp_send_pkt_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
       gnrc_tcp_recv_cmd },
     { "gnrc_tcp_close", "gnrc_tcp: close connection gracefully",
@@ -449,6 +616,8 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_get_remote_cmd },
     { "gnrc_tcp_queue_get_local", "gnrc_tcp: get queue local",
       gnrc_tcp_queue_get_local_cmd },
+    { "gnrc_tcp_get_rcvbuf_stats", "gnrc_tcp: get receive buffer stats",
+      gnrc_tcp_get_rcvbuf_stats_cmd },
     { "buffer_init", "init internal buffer",
       buffer_init_cmd },
     { "buffer_get_max_size", "get max size of internal buffer",
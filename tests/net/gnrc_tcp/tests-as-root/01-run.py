@@ -9,13 +9,14 @@
 import os
 import sys
 import random
+import time
 import pexpect
 import base64
 
-from scapy.all import Ether, IPv6, TCP, raw, sendp
+from scapy.all import Ether, IPv6, TCP, raw, sendp, srp1
 
 from helpers import Runner, RiotTcpServer, RiotTcpClient, HostTcpServer, HostTcpClient, \
-                    generate_port_number, sudo_guard
+                    HostRawTcpClient, generate_port_number, sudo_guard
 
 # Custom NO_TIMEOUT constant. Note: the value must match
 # with CUSTOM_GNRC_TCP_NO_TIMEOUT from the makefile
@@ -65,6 +66,39 @@ def test_send_data_from_riot_to_host(child):
             host_srv.close()
 
 
+@Runner(timeout=5)
+def test_send_iolist_from_riot_to_host(child):
+    """ Send data spread over a multi-element iolist from RIOT Node to Host
+        system, the amount is not a multiple of the MSS
+    """
+    with HostTcpServer(generate_port_number()) as host_srv:
+        with RiotTcpClient(child, host_srv) as riot_cli:
+            host_srv.accept()
+
+            # Elements and segments end at different offsets
+            data = ''.join(chr(ord('a') + (i % 26)) for i in range(1999))
+            riot_cli.send_iolist(timeout_ms=0, payload_to_send=data, elements=7)
+            host_srv.receive(data)
+
+            host_srv.close()
+
+
+@Runner(timeout=5)
+def test_send_pkt_from_riot_to_host(child):
+    """ Send data held in a chain of snips from RIOT Node to Host system, the
+        amount is not a multiple of the MSS, so segments split snips
+    """
+    with HostTcpServer(generate_port_number()) as host_srv:
+        with RiotTcpClient(child, host_srv) as riot_cli:
+            host_srv.accept()
+
+            data = ''.join(chr(ord('a') + (i % 26)) for i in range(1999))
+            riot_cli.send_pkt(timeout_ms=0, payload_to_send=data, snip_size=300)
+            host_srv.receive(data)
+
+            host_srv.close()
+
+
 @Runner(timeout=5)
 def test_send_data_from_host_to_riot(child):
     """ Send Data from Host system to RIOT node """
@@ -83,6 +117,237 @@ def test_send_data_from_host_to_riot(child):
             riot_srv.close()
 
 
+@Runner(timeout=10)
+def test_send_data_from_riot_to_host_with_forced_drop(child):
+    """ Send data from RIOT to a host that drops the first segment. RIOT must
+        retransmit it once the retransmission timer fires. Run with
+        TCP_CONGURE=reno or TCP_CONGURE=abe to cover loss reporting to CongURE.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        # A small MSS splits the data into several segments
+        with HostRawTcpClient(riot_srv, mss=200) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            host_cli.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            data = '0123456789' * 60
+            riot_srv.send_begin(timeout_ms=0, payload_to_send=data)
+
+            # Drop the first segment, keep the rest without acknowledging it
+            received = {}
+            first = host_cli.receive()
+            assert first is not None and len(first[TCP].payload) > 0
+            while True:
+                seg = host_cli.receive(timeout=0.5)
+                if seg is None:
+                    break
+                assert seg[TCP].seq != first[TCP].seq
+                received[seg[TCP].seq] = raw(seg[TCP].payload)
+
+            # Timeout based retransmission of the dropped segment
+            seg = host_cli.receive(timeout=5)
+            assert seg is not None and seg[TCP].seq == first[TCP].seq
+            received[seg[TCP].seq] = raw(seg[TCP].payload)
+
+            # Acknowledge everything, RIOT sends data it held back meanwhile
+            total = sum(len(payload) for payload in received.values())
+            while total < len(data):
+                host_cli.send_ack(ack=first[TCP].seq + total)
+                seg = host_cli.receive()
+                assert seg is not None
+                received[seg[TCP].seq] = raw(seg[TCP].payload)
+                total = sum(len(payload) for payload in received.values())
+            host_cli.send_ack(ack=first[TCP].seq + total)
+            riot_srv.send_end(len(data))
+
+            stream = b''.join(received[seq] for seq in sorted(received,
+                              key=lambda seq: (seq - first[TCP].seq) & 0xffffffff))
+            assert stream == data.encode('utf-8')
+
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_send_data_from_host_to_riot_out_of_order(child):
+    """ Send data from host to RIOT out of order. RIOT must report the
+        out-of-order data in SACK blocks and deliver the data in order once
+        the gaps are filled.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with HostRawTcpClient(riot_srv, sack_ok=True) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            host_cli.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            data = ''.join(chr(ord('a') + (i % 26)) for i in range(400))
+            chunks = [data[i:i + 100].encode('utf-8') for i in range(0, len(data), 100)]
+            start = host_cli.snd_nxt
+
+            def send_and_check(offset, payload, ack, sack):
+                host_cli.send_data(payload, offset)
+                seg = host_cli.receive()
+                assert seg is not None and seg[TCP].flags == 'A'
+                assert seg[TCP].ack == (start + ack) & 0xffffffff
+                blocks = [opt[1] for opt in seg[TCP].options if opt[0] == 'SAck']
+                expected = [tuple((start + edge) & 0xffffffff for edge in blk) for blk in sack]
+                assert blocks == ([sum(expected, ())] if expected else [])
+
+            # Most recently received block first (RFC 2018, section 4)
+            send_and_check(100, chunks[1], ack=0, sack=[(100, 200)])
+            send_and_check(300, chunks[3], ack=0, sack=[(300, 400), (100, 200)])
+            send_and_check(0, chunks[0], ack=200, sack=[(300, 400)])
+            send_and_check(200, chunks[2], ack=400, sack=[])
+            host_cli.snd_nxt = (start + len(data)) & 0xffffffff
+
+            riot_srv.receive(timeout_ms=1000, sent_payload=data)
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_send_data_from_riot_to_host_fast_retransmit(child):
+    """ Send data from RIOT to a host that drops the first segment and
+        answers the following ones with duplicate ACKs. The third duplicate
+        ACK must trigger the retransmission, long before the retransmission
+        timer fires.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with HostRawTcpClient(riot_srv, mss=200) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            host_cli.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            # Four segments fit into the initial window
+            data = '0123456789' * 80
+            riot_srv.send_begin(timeout_ms=0, payload_to_send=data)
+
+            segs = [host_cli.receive() for _ in range(4)]
+            assert None not in segs
+            first = segs[0][TCP].seq
+
+            host_cli.send_ack(ack=first)
+            host_cli.send_ack(ack=first)
+            assert host_cli.receive(timeout=0.2) is None
+            host_cli.send_ack(ack=first)
+
+            # The retransmission timer fires after a second at the earliest
+            seg = host_cli.receive(timeout=0.5)
+            assert seg is not None and seg[TCP].seq == first
+            assert raw(seg[TCP].payload) == raw(segs[0][TCP].payload)
+
+            host_cli.send_ack(ack=first + len(data))
+            riot_srv.send_end(len(data))
+            assert b''.join(raw(seg[TCP].payload) for seg in segs) == data.encode('utf-8')
+
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_send_long_data_from_riot_to_host(child):
+    """ Send data from RIOT to host in far more segments than the
+        retransmission queue (CONFIG_GNRC_TCP_RTX_QUEUE_SIZE) holds, so it
+        wraps around many times.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with HostRawTcpClient(riot_srv, mss=100) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            host_cli.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            data = ''.join(chr(ord('a') + (i % 26)) for i in range(2000))
+            riot_srv.send_begin(timeout_ms=0, payload_to_send=data)
+
+            # Acknowledge every segment on its own
+            stream = b''
+            start = None
+            while len(stream) < len(data):
+                seg = host_cli.receive()
+                assert seg is not None
+                if start is None:
+                    start = seg[TCP].seq
+                assert seg[TCP].seq == (start + len(stream)) & 0xffffffff
+                stream += raw(seg[TCP].payload)
+                host_cli.send_ack(ack=start + len(stream))
+            riot_srv.send_end(len(data))
+            assert stream == data.encode('utf-8')
+
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_send_data_from_host_to_riot_wraps_sequence_space(child):
+    """ Send data from host to RIOT with sequence numbers wrapping around
+        2^32 in the middle of the transfer. RIOT picks its own initial
+        sequence number at random, so only the direction towards RIOT is
+        under the control of the test.
+    """
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with HostRawTcpClient(riot_srv, iss=0xffffffff - 450) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            host_cli.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            data = ''.join(chr(ord('a') + (i % 26)) for i in range(1000))
+            for i in range(0, len(data), 100):
+                host_cli.send_data(data[i:i + 100].encode('utf-8'))
+                host_cli.snd_nxt = (host_cli.snd_nxt + 100) & 0xffffffff
+                seg = host_cli.receive()
+                assert seg is not None and seg[TCP].ack == host_cli.snd_nxt
+
+            riot_srv.receive(timeout_ms=1000, sent_payload=data)
+            riot_srv.abort()
+
+
+@Runner(timeout=20)
+def test_gnrc_tcp_rcvbuf_stats(child):
+    """ This test verifies that the receive buffer statistics account for
+        received data, that the receive buffer grows beyond the default window
+        for a bulk transfer, that it stays within its limits and that it
+        shrinks again once the transfer slowed down.
+    """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        # Setup Host as client
+        with HostTcpClient(riot_srv) as host_cli:
+            riot_srv.accept(timeout_ms=1000)
+
+            # Send data from Host system to RIOT, each round exceeds the
+            # default window, so the buffer has to grow to keep up
+            data = '0123456789' * 200
+            rounds = 5
+            for _ in range(rounds):
+                host_cli.send(data)
+                riot_srv.receive(timeout_ms=1000, sent_payload=data)
+
+            child.sendline('gnrc_tcp_get_rcvbuf_stats')
+            child.expect_exact('gnrc_tcp_get_rcvbuf_stats: returns')
+            child.expect(r'Stats: size=(\d+) size_max=(\d+) avail=(\d+) read=(\d+) '
+                         r'grown=(\d+) ')
+            size, size_max, avail, read, grown = (int(x) for x in child.match.groups())
+            assert 0 < size <= size_max
+            assert avail == 0
+            assert read == rounds * len(data)
+            assert grown > 0
+
+            # Stay idle until the autotuning timer decided to shrink, then
+            # trickle data until the peer used up the window it was offered
+            time.sleep(2.5)
+            chunk = '0123456789' * 30
+            for _ in range(size_max // len(chunk) + 1):
+                host_cli.send(chunk)
+                riot_srv.receive(timeout_ms=1000, sent_payload=chunk)
+                time.sleep(0.1)
+
+            child.sendline('gnrc_tcp_get_rcvbuf_stats')
+            child.expect_exact('gnrc_tcp_get_rcvbuf_stats: returns')
+            child.expect(r'Stats: size=(\d+) size_max=(\d+) avail=(\d+) read=(\d+) '
+                         r'grown=(\d+) shrunk=(\d+) ')
+            size, size_max, _, _, _, shrunk = (int(x) for x in child.match.groups())
+            assert shrunk > 0
+            assert size < size_max
+
+            riot_srv.close()
+
+
 @Runner(timeout=5)
 def test_gnrc_tcp_garbage_packets_short_payload(child):
     """ Receive unusually short payload with timeout. Verifies fix for
@@ -216,6 +481,170 @@ def test_gnrc_tcp_garbage_packets_option_parsing(child):
         riot_srv.close()
 
 
+@Runner(timeout=5)
+def test_gnrc_tcp_syn_ack_options(child):
+    """ This test verifies that a SYN-ACK answers window scaling and
+        SACK-permitted options of a SYN.
+    """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        # Construct HostTcpClient to lookup node properties
+        host_cli = HostTcpClient(riot_srv)
+
+        # Try to accept incoming connection from host system.
+        child.sendline('gnrc_tcp_accept 2000')
+
+        tcp_hdr = TCP(
+            dport=int(riot_srv.listen_port), flags="S", sport=2342, seq=1,
+            options=[('MSS', 1220), ('SAckOK', b''), ('WScale', 2)]
+        )
+
+        syn_ack = srp1(
+            Ether(dst=riot_srv.mac) / IPv6(src=host_cli.address, dst=riot_srv.address) /
+            tcp_hdr, iface=host_cli.interface, verbose=0, timeout=2
+        )
+        assert syn_ack is not None and TCP in syn_ack
+        assert syn_ack[TCP].flags == "SA"
+        options = [opt[0] for opt in syn_ack[TCP].options]
+        assert 'MSS' in options
+        assert 'SAckOK' in options
+        assert 'WScale' in options
+
+        # Reset the half-open connection
+        sendp(
+            Ether(dst=riot_srv.mac) / IPv6(src=host_cli.address, dst=riot_srv.address) /
+            TCP(dport=int(riot_srv.listen_port), flags="R", sport=2342, seq=2),
+            iface=host_cli.interface, verbose=0
+        )
+
+        # check if server actually still works
+        with host_cli:
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+        riot_srv.close()
+
+
+@Runner(timeout=10)
+def test_gnrc_tcp_fastopen_cookie(child):
+    """ This test verifies that a SYN-ACK hands out a TCP Fast Open cookie
+        on request and that data of a SYN with a valid cookie is acknowledged,
+        but only by a listener that enabled TCP Fast Open.
+    """
+    # Setup RIOT as server without TCP Fast Open
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        host_cli = HostTcpClient(riot_srv)
+        ip_hdr = Ether(dst=riot_srv.mac) / IPv6(src=host_cli.address, dst=riot_srv.address)
+        port = int(riot_srv.listen_port)
+
+        # Request a cookie and send data along with a made up one
+        for sport, cookie, payload in ((2340, b'', b''),
+                                       (2341, b'\x00' * 8, b'fastopen')):
+            syn_ack = srp1(
+                ip_hdr / TCP(dport=port, flags="S", sport=sport, seq=1,
+                             options=[('MSS', 1220), ('TFO', cookie)]) / payload,
+                iface=host_cli.interface, verbose=0, timeout=2
+            )
+            assert syn_ack is not None and TCP in syn_ack
+            assert syn_ack[TCP].flags == "SA"
+            assert syn_ack[TCP].ack == 2
+            assert not [opt for opt in syn_ack[TCP].options if opt[0] == 'TFO']
+            sendp(ip_hdr / TCP(dport=port, flags="R", sport=sport, seq=2),
+                  iface=host_cli.interface, verbose=0)
+
+    # Setup RIOT as server with TCP Fast Open
+    with RiotTcpServer(child, generate_port_number(), fastopen=True) as riot_srv:
+        # Construct HostTcpClient to lookup node properties
+        host_cli = HostTcpClient(riot_srv)
+
+        # Try to accept incoming connection from host system.
+        child.sendline('gnrc_tcp_accept 5000')
+
+        ip_hdr = Ether(dst=riot_srv.mac) / IPv6(src=host_cli.address, dst=riot_srv.address)
+        port = int(riot_srv.listen_port)
+
+        # Request a cookie
+        syn_ack = srp1(
+            ip_hdr / TCP(dport=port, flags="S", sport=2342, seq=1,
+                         options=[('MSS', 1220), ('TFO', b'')]),
+            iface=host_cli.interface, verbose=0, timeout=2
+        )
+        assert syn_ack is not None and TCP in syn_ack
+        assert syn_ack[TCP].flags == "SA"
+        assert syn_ack[TCP].ack == 2
+        cookies = [opt[1] for opt in syn_ack[TCP].options if opt[0] == 'TFO']
+        assert len(cookies) == 1 and len(cookies[0]) == 8
+        sendp(ip_hdr / TCP(dport=port, flags="R", sport=2342, seq=2),
+              iface=host_cli.interface, verbose=0)
+
+        # Send data along with the cookie
+        payload = b'fastopen'
+        syn_ack = srp1(
+            ip_hdr / TCP(dport=port, flags="S", sport=2343, seq=100,
+                         options=[('MSS', 1220), ('TFO', cookies[0])]) / payload,
+            iface=host_cli.interface, verbose=0, timeout=2
+        )
+        assert syn_ack is not None and TCP in syn_ack
+        assert syn_ack[TCP].flags == "SA"
+        assert syn_ack[TCP].ack == 101 + len(payload)
+        sendp(ip_hdr / TCP(dport=port, flags="R", sport=2343, seq=101 + len(payload)),
+              iface=host_cli.interface, verbose=0)
+
+        # check if server actually still works
+        with host_cli:
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+        riot_srv.close()
+
+
+@Runner(timeout=15)
+def test_gnrc_tcp_fastopen_time_to_first_byte(child):
+    """ This test measures the time from sending a SYN until RIOT acknowledged
+        the first data byte, once with data sent after the three-way handshake
+        and once with data carried by a SYN with a TCP Fast Open cookie. If no
+        cookie is handed out (gnrc_tcp_fastopen not used) only the former is
+        measured.
+    """
+    payload = '0123456789'
+
+    def _time_to_first_byte(riot_srv, cookie=None):
+        with HostRawTcpClient(riot_srv) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            iss = host_cli.snd_nxt
+            start = time.monotonic()
+            if cookie is None:
+                host_cli.connect()
+                host_cli.send_data(payload.encode('utf-8'))
+                host_cli.snd_nxt = (host_cli.snd_nxt + len(payload)) & 0xffffffff
+                seg = host_cli.receive()
+                assert seg is not None and seg[TCP].ack == host_cli.snd_nxt
+            else:
+                host_cli.connect(cookie=cookie, payload=payload.encode('utf-8'))
+            elapsed = time.monotonic() - start
+            assert host_cli.snd_nxt == (iss + 1 + len(payload)) & 0xffffffff
+
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+            riot_srv.receive(timeout_ms=1000, sent_payload=payload)
+            riot_srv.abort()
+        return elapsed * 1000
+
+    with RiotTcpServer(child, generate_port_number(), fastopen=True) as riot_srv:
+        # Request a cookie
+        with HostRawTcpClient(riot_srv) as host_cli:
+            child.sendline('gnrc_tcp_accept 2000')
+            syn_ack = host_cli.connect(cookie=b'')
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+            riot_srv.abort()
+        cookies = [opt[1] for opt in syn_ack[TCP].options if opt[0] == 'TFO']
+
+        print('\ntime to first byte with three-way handshake: {:.2f} ms'
+              .format(_time_to_first_byte(riot_srv)))
+        if cookies:
+            print('time to first byte with TCP Fast Open: {:.2f} ms'
+                  .format(_time_to_first_byte(riot_srv, cookies[0])))
+        else:
+            print('no TCP Fast Open cookie received, gnrc_tcp_fastopen not used')
+
+
 @Runner(timeout=5)
 def test_gnrc_tcp_recv_behavior_on_closed_connection(child):
     """ This test ensures that a gnrc_tcp_recv doesn't block if a connection
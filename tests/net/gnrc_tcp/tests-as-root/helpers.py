@@ -12,6 +12,8 @@ import socket
 import random
 import testrunner
 
+from scapy.all import Ether, IPv6, TCP, conf, sniff
+
 
 class Runner:
     def __init__(self, timeout, echo=False, skip=False):
@@ -138,20 +140,41 @@ class _RiotTcpNode:
         self.child.expect_exact('gnrc_tcp_tcb_init: returns')
 
     def send(self, timeout_ms, payload_to_send, bytes_to_send=None):
-        total_bytes = len(payload_to_send)
+        self._send('gnrc_tcp_send', timeout_ms, payload_to_send, bytes_to_send)
+
+    def send_iolist(self, timeout_ms, payload_to_send, elements):
+        self._send('gnrc_tcp_send_iolist', timeout_ms, payload_to_send, None, elements)
+
+    def send_pkt(self, timeout_ms, payload_to_send, snip_size):
+        self._send('gnrc_tcp_send_pkt', timeout_ms, payload_to_send, None, snip_size)
+
+    def send_begin(self, timeout_ms, payload_to_send):
+        # Returns without waiting for gnrc_tcp_send, the caller plays the
+        # peer in the meantime and calls send_end() afterwards
+        self._send_begin('gnrc_tcp_send', timeout_ms, payload_to_send, len(payload_to_send))
+
+    def send_end(self, bytes_sent):
+        self._send_end('gnrc_tcp_send', bytes_sent)
 
+    def _send(self, cmd, timeout_ms, payload_to_send, bytes_to_send, *args):
         if bytes_to_send is None:
-            bytes_to_send = total_bytes
+            bytes_to_send = len(payload_to_send)
 
+        self._send_begin(cmd, timeout_ms, payload_to_send, bytes_to_send, *args)
+        self._send_end(cmd, bytes_to_send)
+
+    def _send_begin(self, cmd, timeout_ms, payload_to_send, bytes_to_send, *args):
         # Verify that internal buffer can hold the given amount of data
-        assert self._setup_internal_buffer() >= total_bytes
+        assert self._setup_internal_buffer() >= len(payload_to_send)
 
         # Write data to RIOT nodes internal buffer
         self._write_data_to_internal_buffer(payload_to_send)
 
         # Send buffer contents via tcp
-        self.child.sendline('gnrc_tcp_send {} {}'.format(timeout_ms, bytes_to_send))
-        self.child.expect_exact('gnrc_tcp_send: sent {}'.format(bytes_to_send))
+        self.child.sendline(' '.join(str(x) for x in (cmd, timeout_ms, bytes_to_send) + args))
+
+    def _send_end(self, cmd, bytes_sent):
+        self.child.expect_exact('{}: sent {}'.format(cmd, bytes_sent))
 
         # Verify that packet buffer is empty
         self._verify_pktbuf_empty()
@@ -241,11 +264,12 @@ class _RiotTcpNode:
 
 
 class RiotTcpServer(_RiotTcpNode):
-    def __init__(self, child, listen_port, listen_addr='::'):
+    def __init__(self, child, listen_port, listen_addr='::', fastopen=False):
         super().__init__(child)
         self.listening = False
         self.listen_port = str(listen_port)
         self.listen_addr = str(listen_addr)
+        self.fastopen = fastopen
         self.tcb_init()
 
     def __enter__(self):
@@ -258,10 +282,11 @@ class RiotTcpServer(_RiotTcpNode):
             self.stop_listen()
 
     def listen(self):
-        self.child.sendline('gnrc_tcp_listen [{}]:{}'.format(
-            self.listen_addr, self.listen_port)
+        cmd = 'gnrc_tcp_listen_fastopen' if self.fastopen else 'gnrc_tcp_listen'
+        self.child.sendline('{} [{}]:{}'.format(
+            cmd, self.listen_addr, self.listen_port)
         )
-        self.child.expect_exact('gnrc_tcp_listen: returns 0')
+        self.child.expect_exact('{}: returns 0'.format(cmd))
         self.listening = True
 
     def accept(self, timeout_ms):
@@ -305,6 +330,94 @@ class RiotTcpClient(_RiotTcpNode):
         self.opened = True
 
 
+class HostRawTcpClient:
+    """ TCP client built from raw frames via scapy. Unlike HostTcpClient it
+        leaves every segment to the test, e.g. to drop or reorder data or to
+        send duplicate ACKs. The host kernel doesn't know the connection, its
+        resets are filtered while the client is in use.
+    """
+    def __init__(self, target, mss=1220, window=8192, sack_ok=False, iss=None):
+        # Lookup host properties like HostTcpClient does
+        lookup = HostTcpClient(target)
+        lookup.close()
+        self.interface = lookup.interface
+        self.address = lookup.address
+        self.target_mac = target.mac
+        self.target_addr = str(target.address)
+        self.target_port = int(target.listen_port)
+        self.port = generate_port_number()
+        self.mss = mss
+        self.window = window
+        self.sack_ok = sack_ok
+        self.snd_nxt = random.randint(0, 0xffffffff) if iss is None else iss
+        self.rcv_nxt = None
+        self.sock = None
+
+    def __enter__(self):
+        self._filter_resets('-I')
+        self.sock = conf.L2socket(iface=self.interface)
+        return self
+
+    def __exit__(self, _1, _2, _3):
+        if self.rcv_nxt is not None:
+            self.send_segment('R', seq=self.snd_nxt, ack=0)
+            self.rcv_nxt = None
+        self.sock.close()
+        self._filter_resets('-D')
+
+    def connect(self, cookie=None, payload=b''):
+        """ Perform the three-way handshake and return the SYN-ACK. If cookie
+            is not None, a TCP Fast Open option is added to the SYN: an empty
+            cookie requests one, a valid cookie lets payload be acknowledged
+            by the SYN-ACK """
+        options = [('MSS', self.mss)]
+        if self.sack_ok:
+            options.append(('SAckOK', b''))
+        if cookie is not None:
+            options.append(('TFO', cookie))
+
+        self.send_segment('S', seq=self.snd_nxt, ack=0, payload=payload, options=options)
+        syn_ack = self.receive()
+        assert syn_ack is not None and syn_ack[TCP].flags == 'SA'
+        acked = (syn_ack[TCP].ack - self.snd_nxt - 1) & 0xffffffff
+        assert acked in (0, len(payload))
+
+        self.snd_nxt = (self.snd_nxt + 1 + acked) & 0xffffffff
+        self.rcv_nxt = (syn_ack[TCP].seq + 1) & 0xffffffff
+        self.send_ack()
+        return syn_ack
+
+    def send_data(self, payload, offset=0):
+        """ Send payload at offset bytes behind snd_nxt, snd_nxt is left as
+            it is to allow sending out of order """
+        self.send_segment('PA', seq=self.snd_nxt + offset, ack=self.rcv_nxt, payload=payload)
+
+    def send_ack(self, ack=None, sack=()):
+        options = [('SAck', tuple(sack))] if sack else []
+        self.send_segment('A', seq=self.snd_nxt, ack=self.rcv_nxt if ack is None else ack,
+                          options=options)
+
+    def send_segment(self, flags, seq, ack, payload=b'', options=()):
+        tcp_hdr = TCP(sport=self.port, dport=self.target_port, flags=flags,
+                      seq=seq & 0xffffffff, ack=ack & 0xffffffff, window=self.window,
+                      options=list(options))
+        self.sock.send(Ether(dst=self.target_mac) /
+                       IPv6(src=self.address, dst=self.target_addr) / tcp_hdr / payload)
+
+    def receive(self, timeout=2):
+        """ Returns the next segment of the target to this client or None """
+        def _match(pkt):
+            return (TCP in pkt and pkt[TCP].sport == self.target_port and
+                    pkt[TCP].dport == self.port)
+
+        pkts = sniff(opened_socket=self.sock, lfilter=_match, count=1, timeout=timeout)
+        return pkts[0] if pkts else None
+
+    def _filter_resets(self, action):
+        assert os.system('ip6tables {} OUTPUT -p tcp --sport {} --tcp-flags RST RST -j DROP'
+                         .format(action, self.port)) == 0
+
+
 def generate_port_number():
     return random.randint(1024, 65535)
 
@@ -23,6 +23,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "container.h"
 #include "net/sock/udp.h"
 #include "test_utils/expect.h"
 #include "ztimer.h"
@@ -1086,6 +1087,42 @@ static void test_sock_udp_recv6__non_blocking(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv6__many(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR6_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t results[3];
+    sock_udp_mmsg_t msgs[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(msgs); i++) {
+        msgs[i].data = &_test_buffer[i * (sizeof(_test_buffer) / ARRAY_SIZE(msgs))];
+        msgs[i].len = sizeof(_test_buffer) / ARRAY_SIZE(msgs);
+        msgs[i].remote = &results[i];
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                           _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                           _TEST_NETIF));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let lwIP stack finish */
+    expect(_inject_6packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                           _TEST_PORT_LOCAL, "EFG", sizeof("EFG"),
+                           _TEST_NETIF));
+    ztimer_sleep(ZTIMER_MSEC, 1);    /* let lwIP stack finish */
+    expect(2 == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(sizeof("ABCD") == msgs[0].msg_len);
+    expect(memcmp(msgs[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == results[0].port);
+    expect(sizeof("EFG") == msgs[1].msg_len);
+    expect(memcmp(msgs[1].data, "EFG", sizeof("EFG")) == 0);
+    expect(AF_INET6 == results[1].family);
+    expect(memcmp(&results[1].addr, &src_addr, sizeof(results[1].addr)) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == results[1].port);
+    expect(-EAGAIN == sock_udp_recv_many(&_sock, msgs, ARRAY_SIZE(msgs), 0));
+    expect(_check_net());
+}
+
 static void test_sock_udp_recv6__aux(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR6_REMOTE };
@@ -1550,6 +1587,7 @@ int main(void)
     CALL(test_sock_udp_recv6__unsocketed_with_remote());
     CALL(test_sock_udp_recv6__with_timeout());
     CALL(test_sock_udp_recv6__non_blocking());
+    CALL(test_sock_udp_recv6__many());
     CALL(test_sock_udp_recv6__aux());
     CALL(test_sock_udp_recv_buf6__success());
     _prepare_send_checks();
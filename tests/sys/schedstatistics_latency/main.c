@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the wakeup latency histograms of
+ *              schedstatistics
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "msg.h"
+#include "sched.h"
+#include "schedstatistics.h"
+#include "thread.h"
+
+#define PRIO            (THREAD_PRIORITY_MAIN - 1)
+#define STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+
+static char _stack[STACKSIZE];
+static uint32_t _hist[CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS];
+static unsigned _received;
+
+static void *_waiter(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    while (1) {
+        msg_receive(&msg);
+        _received++;
+    }
+
+    return NULL;
+}
+
+static void _snapshot(kernel_pid_t pid)
+{
+    memcpy(_hist, sched_pidlist[pid].latency_hist, sizeof(_hist));
+}
+
+/* returns the bucket incremented by exactly one since the last snapshot, -1
+ * if no bucket changed and -2 if the histogram changed otherwise */
+static int _changed_bucket(kernel_pid_t pid)
+{
+    const uint32_t *hist = sched_pidlist[pid].latency_hist;
+    int bucket = -1;
+
+    for (unsigned i = 0; i < CONFIG_SCHEDSTATISTICS_LATENCY_BUCKETS; i++) {
+        if (hist[i] == _hist[i]) {
+            continue;
+        }
+        if ((hist[i] != _hist[i] + 1) || (bucket >= 0)) {
+            return -2;
+        }
+        bucket = i;
+    }
+    return bucket;
+}
+
+int main(void)
+{
+    kernel_pid_t main_pid = thread_getpid();
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack), PRIO, 0,
+                                     _waiter, NULL, "waiter");
+    msg_t msg = { 0 };
+    int bucket;
+
+    /* waking up a blocked thread records exactly one latency */
+    _snapshot(pid);
+    msg_send(&msg, pid);
+    bucket = _changed_bucket(pid);
+    if ((_received != 1) || (bucket < 0)) {
+        printf("[FAILED] wakeup of waiter: bucket %d\n", bucket);
+        return 1;
+    }
+    printf("wakeup of waiter: bucket %d\n", bucket);
+
+    /* blocking and being woken up again before the scheduler switches away
+     * records a latency of zero */
+    _snapshot(main_pid);
+    unsigned state = irq_disable();
+    sched_set_status(thread_get_active(), STATUS_SLEEPING);
+    sched_set_status(thread_get_active(), STATUS_PENDING);
+    irq_restore(state);
+    thread_yield_higher();
+    bucket = _changed_bucket(main_pid);
+    if (bucket != 0) {
+        printf("[FAILED] wakeup of active thread: bucket %d\n", bucket);
+        return 1;
+    }
+
+    /* being preempted afterwards is no wakeup of the main thread */
+    _snapshot(main_pid);
+    msg_send(&msg, pid);
+    bucket = _changed_bucket(main_pid);
+    if ((_received != 2) || (bucket != -1)) {
+        printf("[FAILED] preemption of main: bucket %d\n", bucket);
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
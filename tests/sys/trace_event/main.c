@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       trace_event module test application
+ *
+ * This test application records a user slice and the context switches and
+ * messages between two threads and prints them with trace_event_dump().
+ *
+ * @}
+ */
+
+#include "msg.h"
+#include "thread.h"
+#include "trace_event.h"
+
+#define TEST_EVENT      (TRACE_EVENT_ID_USER + 0)
+#define TEST_MSG_TYPE   (0x42)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_receive(&m);
+    msg_reply(&m, &m);
+
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t m = { .type = TEST_MSG_TYPE };
+    kernel_pid_t pid;
+
+    pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                        0, _thread, NULL, "receiver");
+
+    trace_event_begin(TEST_EVENT, 1);
+    msg_send_receive(&m, &m, pid);
+    trace_event_end(TEST_EVENT, 1);
+
+    trace_event_dump();
+
+    return 0;
+}
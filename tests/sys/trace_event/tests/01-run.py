@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+# time ctx kind id arg
+EVENT = r"te \d+ {ctx} {kind} {id} {arg}\r\n"
+TRACE_EVENT_ID_MSG_SEND = 3
+TRACE_EVENT_ID_MSG_RECV = 4
+TEST_EVENT = 256
+TEST_MSG_TYPE = 0x42
+
+
+def testfunc(child):
+    child.expect(r"trace_event: begin \d+ events\r\n")
+    child.expect(r"te \d+ (\d+) 1 {} 1\r\n".format(TEST_EVENT))
+    main_pid = int(child.match.group(1))
+    child.expect(r"te \d+ {} 0 {} (\d+)\r\n".format(main_pid,
+                                                    TRACE_EVENT_ID_MSG_SEND))
+    receiver_pid = int(child.match.group(1)) >> 16
+    msg_arg = (main_pid << 16) | TEST_MSG_TYPE
+    child.expect(EVENT.format(ctx=receiver_pid, kind=0,
+                              id=TRACE_EVENT_ID_MSG_RECV, arg=msg_arg))
+    child.expect(EVENT.format(ctx=main_pid, kind=2, id=TEST_EVENT, arg=1))
+    child.expect_exact("trace_event: end")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -639,6 +639,75 @@ static void test_nib_ft_del__success(void)
     TEST_ASSERT(!gnrc_ipv6_nib_ft_iter(NULL, 0, &iter_state, &fte));
 }
 
+/*
+ * Creates routes for CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF nested prefixes of the
+ * same address, from the shortest to the longest, and removes them again from
+ * the longest to the shortest.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest prefix configured at that moment
+ */
+static void test_nib_ft_get__success_nested(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i++) {
+        unsigned dst_len = 8 + (i * 4);
+
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, dst_len,
+                                                      &next_hop, IFACE, 0));
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(dst_len, fte.dst_len);
+    }
+    for (unsigned i = CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF; i > 1; i--) {
+        gnrc_ipv6_nib_ft_del(&dst, 8 + ((i - 1) * 4));
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(8 + ((i - 2) * 4), fte.dst_len);
+    }
+    gnrc_ipv6_nib_ft_del(&dst, 8);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+}
+
+/*
+ * Creates routes for CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1 disjoint /48 prefixes
+ * and one /32 prefix covering all of them, then removes every second /48
+ * route.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the /48 route for its
+ * prefix as long as it exists, and the /32 route afterwards
+ */
+static void test_nib_ft_get__success_siblings(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1; i++) {
+        dst.u8[4] = i * 37;
+        dst.u8[5] = i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 48, &next_hop,
+                                                      IFACE, 0));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 32, &next_hop,
+                                                  IFACE, 0));
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1; i += 2) {
+        dst.u8[4] = i * 37;
+        dst.u8[5] = i;
+        gnrc_ipv6_nib_ft_del(&dst, 48);
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF - 1; i++) {
+        dst.u8[4] = i * 37;
+        dst.u8[5] = i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT((i % 2) ? 48 : 32, fte.dst_len);
+        TEST_ASSERT(ipv6_addr_match_prefix(&dst, &fte.dst) >= fte.dst_len);
+    }
+}
+
 /**
  * Creates three default routes and removes the first one.
  * The prefix list is then iterated.
@@ -748,6 +817,8 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_add__success_dr),
         new_TestFixture(test_nib_ft_del__unknown),
         new_TestFixture(test_nib_ft_del__success),
+        new_TestFixture(test_nib_ft_get__success_nested),
+        new_TestFixture(test_nib_ft_get__success_siblings),
         /* most of gnrc_ipv6_nib_ft_iter() is tested during all the tests above */
         new_TestFixture(test_nib_ft_iter__empty_def_route_at_beginning),
         new_TestFixture(test_nib_ft_iter__empty_pref_route_in_the_middle),
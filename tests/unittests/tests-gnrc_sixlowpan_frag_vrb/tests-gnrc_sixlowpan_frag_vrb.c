@@ -156,6 +156,46 @@ static void test_vrb_rm(void)
                                                  _base.tag));
 }
 
+static void test_vrb_rm__others_kept(void)
+{
+    gnrc_sixlowpan_frag_rb_base_t base = _base;
+    gnrc_sixlowpan_frag_vrb_t *res;
+
+    base.ints = NULL;
+    /* fill up VRB */
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_vrb_add(&base,
+                                                         &_dummy_netif,
+                                                         _out_dst,
+                                                         sizeof(_out_dst)));
+        base.tag++;
+    }
+    TEST_ASSERT_NOT_NULL((res = gnrc_sixlowpan_frag_vrb_get(base.src,
+                                                            base.src_len,
+                                                            _base.tag + 1)));
+    gnrc_sixlowpan_frag_vrb_rm(res);
+    /* removing twice has no effect */
+    gnrc_sixlowpan_frag_vrb_rm(res);
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        res = gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                          _base.tag + i);
+        if (i == 1) {
+            TEST_ASSERT_NULL(res);
+        }
+        else {
+            TEST_ASSERT_NOT_NULL(res);
+            TEST_ASSERT_EQUAL_INT(_base.tag + i, res->super.tag);
+        }
+    }
+    /* the freed entry can be taken by a new datagram */
+    TEST_ASSERT_NOT_NULL((res = gnrc_sixlowpan_frag_vrb_add(&base,
+                                                            &_dummy_netif,
+                                                            _out_dst,
+                                                            sizeof(_out_dst))));
+    TEST_ASSERT(res == gnrc_sixlowpan_frag_vrb_get(base.src, base.src_len,
+                                                   base.tag));
+}
+
 static void test_vrb_gc(void)
 {
     gnrc_sixlowpan_frag_rb_base_t base = _base;
@@ -180,6 +220,7 @@ static Test *tests_gnrc_sixlowpan_frag_vrb_tests(void)
         new_TestFixture(test_vrb_get__empty),
         new_TestFixture(test_vrb_get__after_add),
         new_TestFixture(test_vrb_rm),
+        new_TestFixture(test_vrb_rm__others_kept),
         new_TestFixture(test_vrb_gc),
     };
 
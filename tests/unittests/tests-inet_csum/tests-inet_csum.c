@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,31 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* RFC 1071 example, repeated to exercise the word-wise loop */
+    static const uint8_t pattern[] = {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7
+    };
+    uint32_t buf_u32[(5 * sizeof(pattern) + 8) / sizeof(uint32_t)];
+    uint8_t *buf = (uint8_t *)buf_u32;
+
+    for (unsigned offset = 0; offset < 4; offset++) {
+        for (unsigned i = 0; i < 5; i++) {
+            memcpy(&buf[offset + (i * sizeof(pattern))], pattern,
+                   sizeof(pattern));
+        }
+        /* 5 * 0x2ddf0, folded */
+        TEST_ASSERT_EQUAL_INT(0x55be,
+                              inet_csum(0, &buf[offset], 5 * sizeof(pattern)));
+        /* same data split at an odd length */
+        TEST_ASSERT_EQUAL_INT(0x55be,
+                              inet_csum_slice(inet_csum(0, &buf[offset], 13),
+                                              &buf[offset + 13],
+                                              5 * sizeof(pattern) - 13, 13));
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +202,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
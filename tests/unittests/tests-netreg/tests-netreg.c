@@ -185,6 +185,38 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_getnext__many_ctx(void)
+{
+    gnrc_netreg_entry_t many[16];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        /* two entries per context */
+        gnrc_netreg_entry_init_pid(&many[i], TEST_UINT16 + (i % 8), TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 0; i < 8; i++) {
+        gnrc_netreg_entry_t *res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                      TEST_UINT16 + i);
+        unsigned num = 0;
+
+        while (res) {
+            TEST_ASSERT_EQUAL_INT(TEST_UINT16 + i, res->demux_ctx);
+            num++;
+            res = gnrc_netreg_getnext(res);
+        }
+        TEST_ASSERT_EQUAL_INT(2, num);
+    }
+    gnrc_netreg_release_shared();
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[3]);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 3));
+    TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 4));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 8));
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +233,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__many_ctx),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
@@ -288,6 +288,38 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Testing ztimer_set_with_slack()
+ */
+static void test_ztimer_mock_set_with_slack(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+
+    uint32_t count = 0;
+    ztimer_t alarm = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm2 = { .callback = cb_incr, .arg = &count, };
+    ztimer_t alarm3 = { .callback = cb_incr, .arg = &count, };
+
+    ztimer_set(z, &alarm, 1000);
+    /* within slack of alarm, will fire together with it */
+    ztimer_set_with_slack(z, &alarm2, 950, 100);
+    /* no other timer within slack, will fire on time */
+    ztimer_set_with_slack(z, &alarm3, 500, 10);
+
+    ztimer_mock_advance(&zmock, 500);     /* now =  500 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    ztimer_mock_advance(&zmock, 450);     /* now =  950 */
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(ztimer_is_set(z, &alarm2));
+    ztimer_mock_advance(&zmock,  50);     /* now = 1000 */
+    TEST_ASSERT_EQUAL_INT(3, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarm));
+    TEST_ASSERT(!ztimer_is_set(z, &alarm2));
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -298,6 +330,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_set_with_slack),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 The RIOT developers
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unit tests for ztimer_wheel
+ */
+
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define TIMERS_NUMOF    (4U)
+
+static uint32_t _fired_at[TIMERS_NUMOF];
+static ztimer_mock_t _zmock;
+
+static void _cb_record(void *arg)
+{
+    uint32_t *fired_at = arg;
+
+    *fired_at = _zmock.now;
+}
+
+static void _setup_timers(ztimer_t *timers)
+{
+    for (unsigned i = 0; i < TIMERS_NUMOF; i++) {
+        timers[i] = (ztimer_t){ .callback = _cb_record, .arg = &_fired_at[i] };
+        _fired_at[i] = 0;
+    }
+}
+
+/**
+ * @brief   Timers on all wheel levels fire exactly on their target
+ */
+static void test_ztimer_wheel_set(void)
+{
+    ztimer_wheel_t wheel;
+    ztimer_t timers[TIMERS_NUMOF];
+    ztimer_clock_t *z = &_zmock.super;
+
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_wheel_init(z, &wheel);
+    _setup_timers(timers);
+
+    ztimer_mock_advance(&_zmock, 7);
+    ztimer_set(z, &timers[0], 5);
+    ztimer_set(z, &timers[1], 1000);
+    ztimer_set(z, &timers[2], 100000);
+    ztimer_set(z, &timers[3], 4000000000ul);
+    TEST_ASSERT_EQUAL_INT(4, wheel.count);
+
+    ztimer_mock_advance(&_zmock, 4);
+    TEST_ASSERT_EQUAL_INT(0, _fired_at[0]);
+    ztimer_mock_advance(&_zmock, 1);
+    TEST_ASSERT_EQUAL_INT(12, _fired_at[0]);
+    TEST_ASSERT(!ztimer_is_set(z, &timers[0]));
+
+    ztimer_mock_advance(&_zmock, 100000);
+    TEST_ASSERT_EQUAL_INT(1007, _fired_at[1]);
+    TEST_ASSERT_EQUAL_INT(100007, _fired_at[2]);
+    TEST_ASSERT(ztimer_is_set(z, &timers[3]));
+
+    ztimer_mock_advance(&_zmock, 4000000000ul);
+    TEST_ASSERT_EQUAL_INT(4000000007ul, _fired_at[3]);
+    TEST_ASSERT_EQUAL_INT(0, wheel.count);
+}
+
+/**
+ * @brief   Removed or re-set timers don't fire on their old target
+ */
+static void test_ztimer_wheel_remove(void)
+{
+    ztimer_wheel_t wheel;
+    ztimer_t timers[TIMERS_NUMOF];
+    ztimer_clock_t *z = &_zmock.super;
+
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_wheel_init(z, &wheel);
+    _setup_timers(timers);
+
+    ztimer_set(z, &timers[0], 100);
+    ztimer_set(z, &timers[1], 100);
+    ztimer_set(z, &timers[2], 2000);
+    TEST_ASSERT(ztimer_remove(z, &timers[0]));
+    TEST_ASSERT(!ztimer_remove(z, &timers[0]));
+    ztimer_set(z, &timers[2], 50);
+
+    ztimer_mock_advance(&_zmock, 5000);
+    TEST_ASSERT_EQUAL_INT(0, _fired_at[0]);
+    TEST_ASSERT_EQUAL_INT(100, _fired_at[1]);
+    TEST_ASSERT_EQUAL_INT(50, _fired_at[2]);
+    TEST_ASSERT_EQUAL_INT(0, wheel.count);
+}
+
+/**
+ * @brief   The wheel only keeps the clock running while it holds timers
+ */
+static void test_ztimer_wheel_ondemand(void)
+{
+    ztimer_wheel_t wheel;
+    ztimer_t timers[TIMERS_NUMOF];
+    ztimer_clock_t *z = &_zmock.super;
+
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_wheel_init(z, &wheel);
+    _setup_timers(timers);
+
+    ztimer_set(z, &timers[0], 10);
+    ztimer_set(z, &timers[1], 20);
+    TEST_ASSERT_EQUAL_INT(1, _zmock.running);
+
+    ztimer_remove(z, &timers[1]);
+    TEST_ASSERT_EQUAL_INT(1, _zmock.running);
+
+    ztimer_mock_advance(&_zmock, 10);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.running);
+    TEST_ASSERT_EQUAL_INT(0, _zmock.armed);
+}
+
+/**
+ * @brief   Timers with overlapping slack windows fire on the same tick
+ */
+static void test_ztimer_wheel_set_with_slack(void)
+{
+    ztimer_wheel_t wheel;
+    ztimer_t timers[TIMERS_NUMOF];
+    ztimer_clock_t *z = &_zmock.super;
+
+    ztimer_mock_init(&_zmock, 32);
+    ztimer_wheel_init(z, &wheel);
+    _setup_timers(timers);
+
+    ztimer_mock_advance(&_zmock, 3);
+    ztimer_set_with_slack(z, &timers[0], 1000, 100);
+    ztimer_set_with_slack(z, &timers[1], 1020, 50);
+    ztimer_set_with_slack(z, &timers[2], 20, 0);
+
+    ztimer_mock_advance(&_zmock, 2000);
+    TEST_ASSERT(_fired_at[0] >= 1003 && _fired_at[0] <= 1103);
+    TEST_ASSERT(_fired_at[1] >= 1023 && _fired_at[1] <= 1073);
+    TEST_ASSERT_EQUAL_INT(_fired_at[0], _fired_at[1]);
+    TEST_ASSERT_EQUAL_INT(23, _fired_at[2]);
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_ondemand),
+        new_TestFixture(test_ztimer_wheel_set_with_slack),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */